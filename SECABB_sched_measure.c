@@ -13,9 +13,9 @@
 ////////////////////////////////////
 // clock AND protoThreads configure!
 // You MUST check this file!
-#include "config_1_3_0.h"
+#include "config_1_3_2.h"
 // threading library
-#include "pt_cornell_1_3_0.h"
+#include "pt_cornell_1_3_2.h"
 // yup, the expander
 //#include "port_expander_brl4.h"
 
@@ -36,6 +36,11 @@
 #define start_spi2_critical_section INTEnable(INT_T2, 0)
 #define end_spi2_critical_section INTEnable(INT_T2, 1)
 
+// threads 2 and 3 yield as fast as possible under SCHED_ROUND_ROBIN;
+// define this to have them sleep 2 and 4 mSec in PT_YIELD_TIME_msec
+// under SCHED_SLEEP instead
+//#define use_sleeping_threads
+
 ////////////////////////////////////
 
 /* Demo code for interfacing TFT (ILI9340 controller) to PIC32
@@ -117,6 +122,8 @@ void __ISR(_TIMER_2_VECTOR, ipl2) Timer2Handler(void)
 // update counters in each thread
 int count_thread1, count_thread2, count_thread3 ;
 int count_total, last_count_total ;
+// times the scheduler called threads 2 and 3, yielded or not
+int poll_thread2, poll_thread3 ;
 // thread identifier to set thread parameters
 int thread1_id, thread2_id, thread3_id;
 
@@ -138,11 +145,18 @@ static PT_THREAD (protothread_t1(struct pt *pt))
 // ======================================================
 static PT_THREAD (protothread_t2(struct pt *pt))
 {
+    // runs on every call, before resuming the thread
+    poll_thread2++;
     PT_BEGIN(pt);
       while(1) {
+#ifdef use_sleeping_threads
+        // sleep 2 mSec
+        PT_YIELD_TIME_msec(2);
+#else
         // just yield as fast as possible
         PT_YIELD(pt) ;
         //PT_YIELD_TIME_msec(2);
+#endif
         count_thread2++;
         //delay_ms(2);
         
@@ -154,11 +168,18 @@ static PT_THREAD (protothread_t2(struct pt *pt))
 // ======================================================
 static PT_THREAD (protothread_t3(struct pt *pt))
 {
+    // runs on every call, before resuming the thread
+    poll_thread3++;
     PT_BEGIN(pt);
       while(1) {
+#ifdef use_sleeping_threads
+        // sleep 4 mSec
+        PT_YIELD_TIME_msec(4);
+#else
         // just yield as fast as possible
         PT_YIELD(pt) ;
         //PT_YIELD_TIME_msec(4);
+#endif
         count_thread3++;
         //delay_ms(4);
         
@@ -181,6 +202,7 @@ static PT_THREAD (protothread_serial(struct pt *pt))
     PT_BEGIN(pt);
       static char cmd[30];
       static float value;
+      static int pri;
       crlf;
       while(1) {         
             // send the prompt via DMA to serial
@@ -208,6 +230,7 @@ static PT_THREAD (protothread_serial(struct pt *pt))
                  case 'c':
                      // zero the counters
                      count_thread1 = count_thread2 = count_thread3 = 0 ;
+                     poll_thread2 = poll_thread3 = 0 ;
                      // wait a fixed length of time
                      PT_YIELD_TIME_msec(1000) ;
                      // sum the counters
@@ -216,8 +239,55 @@ static PT_THREAD (protothread_serial(struct pt *pt))
                             count_thread1, count_thread2, count_thread3, count_total);
                     // by spawning a print thread
                     PT_SPAWN(pt, &pt_DMA_output, PT_DMA_PutSerialBuffer(&pt_DMA_output) );                  
+                    // calls into the sleeping threads: about 500 and 250
+                    // under SCHED_SLEEP, as many as thread 1 runs otherwise
+                    sprintf(PT_send_buffer,"polls 2,3 %d %d \r\n", 
+                            poll_thread2, poll_thread3);
+                    PT_SPAWN(pt, &pt_DMA_output, PT_DMA_PutSerialBuffer(&pt_DMA_output) );                  
                     break;
                  
+                 case 'l':
+                     // worst time from ready to running for each priority
+                     // since the last 'l' (SCHED_PRIORITY only)
+                     for (pri=0; pri<PT_PRIORITIES; pri++){
+                        if (pt_latency_max[pri] == 0) continue;
+                        sprintf(PT_send_buffer,"priority %d worst latency %d usec\r\n",
+                                pri, PT_TICKS_TO_USEC(pt_latency_max[pri]));
+                        PT_SPAWN(pt, &pt_DMA_output, PT_DMA_PutSerialBuffer(&pt_DMA_output) );
+                     }
+                     pt_latency_reset();
+                     break;
+                 
+                 case 'd':
+                     // jobs and deadline misses of each periodic thread
+                     // (pt_add_periodic), with the late ones by msec late:
+                     // 1, 2-3, 4-7 ... 128 and more
+                     for (pri=0; pri<pt_task_count; pri++){
+                        if (PT_GET_JOBS(pri) == 0) continue;
+                        sprintf(PT_send_buffer,"thread %d jobs %d missed %d late",
+                                pri, PT_GET_JOBS(pri), PT_GET_MISSES(pri));
+                        PT_SPAWN(pt, &pt_DMA_output, PT_DMA_PutSerialBuffer(&pt_DMA_output) );
+                        sprintf(PT_send_buffer," %d %d %d %d %d %d %d %d\r\n",
+                                PT_GET_TARDY(pri,0), PT_GET_TARDY(pri,1), PT_GET_TARDY(pri,2),
+                                PT_GET_TARDY(pri,3), PT_GET_TARDY(pri,4), PT_GET_TARDY(pri,5),
+                                PT_GET_TARDY(pri,6), PT_GET_TARDY(pri,7));
+                        PT_SPAWN(pt, &pt_DMA_output, PT_DMA_PutSerialBuffer(&pt_DMA_output) );
+                     }
+                     pt_deadline_reset();
+                     break;
+#ifdef use_thread_profile
+                 
+                 case 't':
+                     // top: where the cpu went since the last 't'
+                     sprintf(PT_send_buffer, PT_PROFILE_HEADER);
+                     PT_SPAWN(pt, &pt_DMA_output, PT_DMA_PutSerialBuffer(&pt_DMA_output) );
+                     for (pri=0; pri<pt_task_count; pri++){
+                        pt_profile_string(PT_send_buffer, pri);
+                        PT_SPAWN(pt, &pt_DMA_output, PT_DMA_PutSerialBuffer(&pt_DMA_output) );
+                     }
+                     pt_profile_reset();
+                     break;
+#endif
              }
              
             // never exit while
@@ -290,8 +360,27 @@ void main(void) {
   // SCHED_RATE executes some threads more often then others
   // -- rate=0 fastest, rate=1 half, rate=2 quarter, rate=3 eighth, rate=4 sixteenth,
   // -- rate=5 or greater DISABLE thread!
+  // SCHED_SLEEP is round-robin, but skips threads sleeping in PT_YIELD_TIME_msec
+  // -- with use_sleeping_threads defined above it is the default: threads
+  // -- 2 and 3 then cost nothing between wake-ups, and thread 1
+  // -- gets the passes they took (see host/pt_bench.c "sleep")
+  // -- the serial thread is not called while it waits for input, and if
+  // -- no thread is ready the cpu sleeps until an interrupt ("idle")
+  // SCHED_PRIORITY takes the rate as a priority, 0 highest, and always
+  // runs the best ready thread next ("priority"); 'l' prints the latencies
+  // SCHED_EDF runs the ready periodic thread (pt_add_periodic, ending each
+  // job with PT_YIELD_PERIOD) whose job is due first ("edf"); 'd' prints
+  // deadline misses
+  // With use_thread_profile defined in config_1_3_2.h, every scheduler
+  // times its thread calls and 't' prints the table
+#ifdef use_sleeping_threads
+  pt_sched_method = SCHED_SLEEP ;
+#else
   pt_sched_method = SCHED_ROUND_ROBIN ;
+#endif
   //pt_sched_method = SCHED_RATE ;
+  //pt_sched_method = SCHED_PRIORITY ;
+  //pt_sched_method = SCHED_EDF ;
   // scheduler never exits
   PT_SCHEDULE(protothread_sched(&pt_sched));
   
@@ -24,6 +24,7 @@
 // SPI channel 1 connections to TFT
 #include "tft_master.h"
 #include "tft_gfx.h"
+#include "tft_field.h"
 // need for rand function
 #include <stdlib.h>
 // need for sin function
@@ -126,33 +127,10 @@ void __ISR(_TIMER_2_VECTOR, ipl2) Timer2Handler(void)
 
 // string buffer
 char buffer[60];
-void printLine(int line_number, char* print_buffer, short text_color, short back_color){
-    // line number 0 to 31 
-    /// !!! assumes tft_setRotation(0);
-    // print_buffer is the string to print
-    int v_pos;
-    v_pos = line_number * 10 ;
-    // erase the pixels
-    tft_fillRoundRect(0, v_pos, 239, 8, 1, back_color);// x,y,w,h,radius,color
-    tft_setTextColor(text_color); 
-    tft_setCursor(0, v_pos);
-    tft_setTextSize(1);
-    tft_writeString(print_buffer);
-}
 
-void printLine2(int line_number, char* print_buffer, short text_color, short back_color){
-    // line number 0 to 31 
-    /// !!! assumes tft_setRotation(0);
-    // print_buffer is the string to print
-    int v_pos;
-    v_pos = line_number * 20 ;
-    // erase the pixels
-    tft_fillRoundRect(0, v_pos, 239, 16, 1, back_color);// x,y,w,h,radius,color
-    tft_setTextColor(text_color); 
-    tft_setCursor(0, v_pos);
-    tft_setTextSize(2);
-    tft_writeString(print_buffer);
-}
+// === text fields ================================================
+// each redraws only the characters that changed, see tft_field.h
+static struct tft_field time_field, key_field;
 
 // === Timer Thread =================================================
 // system 1 second interval tick
@@ -175,8 +153,8 @@ static PT_THREAD (protothread_timer(struct pt *pt))
         // toggle the LED on the big board
         mPORTAToggleBits(BIT_0);
         // draw sys_time
-        sprintf(buffer,"Time=%d", sys_time_seconds);
-        printLine2(0, buffer, ILI9340_BLACK, ILI9340_YELLOW);
+        tft_fieldPrintf(&time_field, ILI9340_BLACK, ILI9340_YELLOW,
+                        "Time=%d", sys_time_seconds);
         // NEVER exit while
       } // END WHILE(1)
   PT_END(pt);
@@ -267,8 +245,8 @@ static PT_THREAD (protothread_key(struct pt *pt))
         if (i>11 && i<22 ) sprintf(buffer, "   %x shift-%d", keypad, i-12);
         if (i==22 ) sprintf(buffer,"   %x ahift-*", keypad);
         if (i==23 ) sprintf(buffer,"   %x shift-#", keypad);
-        if (i>-1 && i<12) printLine2(10, buffer, ILI9340_GREEN, ILI9340_BLACK);
-        else if (i>-1) printLine2(10, buffer, ILI9340_RED, ILI9340_BLACK);
+        if (i>-1 && i<12) tft_fieldPrint(&key_field, buffer, ILI9340_GREEN, ILI9340_BLACK);
+        else if (i>-1) tft_fieldPrint(&key_field, buffer, ILI9340_RED, ILI9340_BLACK);
         // NEVER exit while
       } // END WHILE(1)
   PT_END(pt);
@@ -463,6 +441,9 @@ void main(void) {
   tft_fillScreen(ILI9340_BLACK);
   //240x320 vertical display
   tft_setRotation(0); // Use tft_setRotation(1) for 320x240
+  // the old printLine2() rows 0 and 10: 20 size 2 characters across
+  tft_fieldInit(&time_field, 0, 0, 20, 2);
+  tft_fieldInit(&key_field, 0, 200, 20, 2);
   
   // === config threads ========================
   PT_setup();
@@ -16,6 +16,7 @@
 // graphics libraries
 #include "tft_master.h"
 #include "tft_gfx.h"
+#include "tft_field.h"
 // need for rand function
 #include <stdlib.h>
 ////////////////////////////////////
@@ -41,9 +42,6 @@
   MIT license, all text above must be included in any redistribution
  ****************************************************/
 
-// string buffer
-char buffer[60];
-
 // === thread structures ============================================
 // thread control structs
 // note that UART input and output are threads
@@ -54,37 +52,9 @@ static struct pt pt_input, pt_output, pt_DMA_output ;
 // system 1 second interval tick
 int sys_time_seconds ;
 
-// === print utilities ==============================================
-// print a line on the TFT
-// string buffer
-char buffer[60];
-void printLine(int line_number, char* print_buffer, short text_color, short back_color){
-    // line number 0 to 31 
-    /// !!! assumes tft_setRotation(0);
-    // print_buffer is the string to print
-    int v_pos;
-    v_pos = line_number * 10 ;
-    // erase the pixels
-    tft_fillRoundRect(0, v_pos, 239, 8, 1, back_color);// x,y,w,h,radius,color
-    tft_setTextColor(text_color); 
-    tft_setCursor(0, v_pos);
-    tft_setTextSize(1);
-    tft_writeString(print_buffer);
-}
-
-void printLine2(int line_number, char* print_buffer, short text_color, short back_color){
-    // line number 0 to 31 
-    /// !!! assumes tft_setRotation(0);
-    // print_buffer is the string to print
-    int v_pos;
-    v_pos = line_number * 20 ;
-    // erase the pixels
-    tft_fillRoundRect(0, v_pos, 239, 16, 1, back_color);// x,y,w,h,radius,color
-    tft_setTextColor(text_color); 
-    tft_setCursor(0, v_pos);
-    tft_setTextSize(2);
-    tft_writeString(print_buffer);
-}
+// === text fields ================================================
+// each redraws only the characters that changed, see tft_field.h
+static struct tft_field time_field, adc_field;
 
 // === Timer Thread =================================================
 // update a 1 second tick counter
@@ -97,8 +67,8 @@ static PT_THREAD (protothread_timer(struct pt *pt))
         sys_time_seconds++ ;
         
         // draw sys_time
-        sprintf(buffer,"%d", sys_time_seconds);
-        printLine2(1, buffer, ILI9340_YELLOW, ILI9340_BLACK);
+        tft_fieldPrintf(&time_field, ILI9340_YELLOW, ILI9340_BLACK,
+                        "%d", sys_time_seconds);
         // NEVER exit while
       } // END WHILE(1)
   PT_END(pt);
@@ -123,8 +93,8 @@ static PT_THREAD (protothread_adc(struct pt *pt))
         adc_11 = ReadADC10(1);   // 
         
         // print raw ADC, floating voltage, fixed voltage
-        sprintf(buffer, "AN11=%04d AN5=%04d ", adc_11, adc_5);
-        printLine2(5, buffer, ILI9340_YELLOW, ILI9340_BLACK);
+        tft_fieldPrintf(&adc_field, ILI9340_YELLOW, ILI9340_BLACK,
+                        "AN11=%04d AN5=%04d ", adc_11, adc_5);
         
         green_text ;
         cursor_pos(3,1);
@@ -198,6 +168,9 @@ void main(void) {
   tft_fillScreen(ILI9340_BLACK);
   //240x320 vertical display
   tft_setRotation(0); // Use tft_setRotation(1) for 320x240
+  // the old printLine2() rows 1 and 5: 20 size 2 characters across
+  tft_fieldInit(&time_field, 0, 20, 20, 2);
+  tft_fieldInit(&adc_field, 0, 100, 20, 2);
 
   // seed random color
   srand(1);
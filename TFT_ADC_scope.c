@@ -0,0 +1,166 @@
+/*
+ * File:        ADC scope
+ * Author:      Bruce Land
+ * 
+ * Target PIC:  PIC32MX250F128B
+ *
+ * Two channel oscilloscope: Timer2 samples AN11 and AN5 at 2 kHz into a
+ * ring buffer, a thread moves the samples onto the screen with
+ * tft_scopeSample(), one column each (see tft_scope.h).
+ */
+
+////////////////////////////////////
+// clock AND protoThreads configure!
+// You MUST check this file!
+#include "config_1_3_2.h"
+// threading library
+#include "pt_cornell_1_3_2.h"
+
+////////////////////////////////////
+// graphics libraries
+#include "tft_master.h"
+#include "tft_gfx.h"
+#include "tft_scope.h"
+#include "tft_field.h"
+////////////////////////////////////
+
+// === thread structures ============================================
+// thread control structs
+static struct pt pt_timer, pt_scope ;
+
+// system 1 second interval tick
+int sys_time_seconds ;
+
+// the scope
+static struct tft_scope scope;
+
+// === text fields ================================================
+// each redraws only the characters that changed, see tft_field.h
+static struct tft_field rate_field, bytes_field;
+
+// === sample ring buffer ===========================================
+// sample rate: 40 MHz / 20000
+#define Fs 2000
+#define RING 256    // power of 2; 128 mSec of samples
+volatile short ring[RING][2];
+volatile unsigned int ring_in, ring_out;
+// samples lost when the scope thread fell behind
+volatile int ring_lost;
+
+//== Timer 2 interrupt handler ===========================================
+void __ISR(_TIMER_2_VECTOR, ipl2) Timer2Handler(void)
+{
+    mT2ClearIntFlag();
+    if (ring_in - ring_out >= RING) {
+        ring_lost++;
+        return;
+    }
+    // scan order is AN5 then AN11
+    ring[ring_in & (RING-1)][0] = ReadADC10(1);    // AN11
+    ring[ring_in & (RING-1)][1] = ReadADC10(0);    // AN5
+    ring_in++;
+}
+
+// === Timer Thread =================================================
+// once a second: screens per second and SPI bytes per sample
+static PT_THREAD (protothread_timer(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    static unsigned long last_frames, last_samples, last_bytes;
+    static unsigned long samples;
+      while(1) {
+        // yield time 1 second
+        PT_YIELD_TIME_msec(1000) ;
+        sys_time_seconds++ ;
+        
+        samples = scope.samples - last_samples;
+        tft_fieldPrintf(&rate_field, ILI9340_YELLOW, ILI9340_BLACK,
+                "%d s %lu scr/s", sys_time_seconds,
+                scope.frames - last_frames);
+        tft_fieldPrintf(&bytes_field, ILI9340_YELLOW, ILI9340_BLACK,
+                "%lu B/smp lost %d",
+                samples ? (scope.bytes - last_bytes) / samples : 0, ring_lost);
+        last_frames = scope.frames;
+        last_samples = scope.samples;
+        last_bytes = scope.bytes;
+        // NEVER exit while
+      } // END WHILE(1)
+  PT_END(pt);
+} // timer thread
+
+// === Scope Thread =============================================
+// draw every sample the ISR has taken since the last turn
+static PT_THREAD (protothread_scope(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    static short v[2];
+            
+    while(1) {
+        while (ring_out != ring_in) {
+            v[0] = ring[ring_out & (RING-1)][0];
+            v[1] = ring[ring_out & (RING-1)][1];
+            ring_out++;
+            tft_scopeSample(&scope, v);
+        }
+        PT_YIELD(pt);
+        // NEVER exit while
+      } // END WHILE(1)
+  PT_END(pt);
+} // scope thread
+
+// === Main  ======================================================
+void main(void) {
+ //SYSTEMConfigPerformance(PBCLK);
+  
+  ANSELA = 0; ANSELB = 0; 
+
+  // === config threads ==========
+  // turns OFF UART support and debugger pin, unless defines are set
+  PT_setup();
+
+  // === setup system wide interrupts  ========
+  INTEnableSystemMultiVectoredInt();
+  
+    // the ADC ///////////////////////////////////////
+    // same scan of AN11 and AN5 as TFT_ADC_read_SCAN.c
+	CloseADC10();	// ensure the ADC is off before setting the configuration
+    #define PARAM1  ADC_FORMAT_INTG16 | ADC_CLK_AUTO | ADC_AUTO_SAMPLING_ON //
+	#define PARAM2  ADC_VREF_AVDD_AVSS | ADC_OFFSET_CAL_DISABLE | ADC_SCAN_ON | ADC_SAMPLES_PER_INT_2 | ADC_ALT_BUF_OFF | ADC_ALT_INPUT_OFF
+    #define PARAM3 ADC_CONV_CLK_PB | ADC_SAMPLE_TIME_15 | ADC_CONV_CLK_Tcy 
+	#define PARAM4	ENABLE_AN11_ANA | ENABLE_AN5_ANA // 
+	#define PARAM5	SKIP_SCAN_AN0 | SKIP_SCAN_AN1 | SKIP_SCAN_AN2 | SKIP_SCAN_AN3 | SKIP_SCAN_AN4 | SKIP_SCAN_AN6 | SKIP_SCAN_AN7 | SKIP_SCAN_AN8 | SKIP_SCAN_AN9 | SKIP_SCAN_AN10 | SKIP_SCAN_AN12 | SKIP_SCAN_AN13 | SKIP_SCAN_AN14 | SKIP_SCAN_AN15
+    SetChanADC10( ADC_CH0_NEG_SAMPLEA_NVREF); // 
+	OpenADC10( PARAM1, PARAM2, PARAM3, PARAM4, PARAM5 ); // configure ADC using the parameters defined above
+	EnableADC10(); // Enable the ADC
+  ///////////////////////////////////////////////////////
+
+  // init the display
+  tft_init_hw();
+  tft_begin();
+  tft_fillScreen(ILI9340_BLACK);
+  //240x320 vertical display
+  tft_setRotation(0);
+  // two rows of 20 size 2 characters across
+  tft_fieldInit(&rate_field, 0, 0, 20, 2);
+  tft_fieldInit(&bytes_field, 0, 20, 20, 2);
+  // plot below the two text lines, full 10-bit ADC range
+  // for a strip chart use tft_setRotation(1) and TFT_SCOPE_HWSCROLL
+  tft_scopeBegin(&scope, 0, 48, 240, 272, 2, TFT_SCOPE_SWEEP, 0, 1023);
+
+  // timer interrupt at Fs, priority 2
+  OpenTimer2(T2_ON | T2_SOURCE_INT | T2_PS_1_1, 40000000/Fs);
+  ConfigIntTimer2(T2_INT_ON | T2_INT_PRIOR_2);
+  mT2ClearIntFlag(); // and clear the interrupt flag
+
+  // init the threads
+  PT_INIT(&pt_timer);
+  PT_INIT(&pt_scope);
+
+  // round-robin scheduler for threads
+  while (1){
+      PT_SCHEDULE(protothread_timer(&pt_timer));
+      PT_SCHEDULE(protothread_scope(&pt_scope));
+      }
+  } // main
+
+// === end  ======================================================
@@ -39,6 +39,10 @@
 #define use_uart_serial
 // BAUDRATE must match PC terminal emulator setting
 #define BAUDRATE 38400 
+//===use thread profiler========================================
+// IF use_thread_profile IS defined, the scheduler times every thread
+// call with the core timer; costs nothing when it is not
+//#define use_thread_profile
 //==============================================================
 
 #endif	/* CONFIG_H */
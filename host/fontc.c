@@ -0,0 +1,294 @@
+/*
+ * File:   fontc.c
+ *
+ * Host font compiler: turns a bitmap font into a struct tft_font (see
+ * tft_font.h) as C source.
+ *
+ * Build and run from the repo root:
+ *   gcc -O2 -o fontc host/fontc.c
+ *   ./fontc [-aa] [-n name] [-r first-last] font.bdf [font.c]
+ *   ./fontc [-aa] [-n name] [-r first-last] -glcd scale [font.c]
+ *
+ * A BDF font (any TrueType font converts to one with otf2bdf) keeps its
+ * own glyph widths and cell height. -glcd builds a proportional font
+ * from the 5x7 glcdfont.c instead: glyphs trimmed to their ink plus one
+ * column of spacing, enlarged scale times with Scale2x/Scale3x so that
+ * diagonals stay smooth instead of turning into steps.
+ *
+ * -aa makes a 2 bits per pixel anti-aliased font: a BDF font is then
+ * taken to be drawn at twice the size wanted (-glcd enlarges twice as
+ * much), and every 2x2 block of it becomes one pixel of 4 levels.
+ * The default range is ' ' to '~'. The C goes to font.c, or to stdout.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../glcdfont.c"
+
+#define MAXW 128
+#define MAXH 128
+
+static void fail(const char *msg) {
+    fprintf(stderr, "fontc: %s\n", msg);
+    exit(1);
+}
+
+// one glyph being built: levels 0..1 (or 0..4 while anti-aliasing)
+struct glyph {
+    int w, h;
+    unsigned char p[MAXH][MAXW];
+};
+
+static struct glyph glyphs[256];
+static int height;
+
+// === enlarging =========================================================
+// pixel (x,y) of g, background outside
+static int at(const struct glyph *g, int x, int y) {
+    if ((x < 0) || (y < 0) || (x >= g->w) || (y >= g->h)) return 0;
+    return g->p[y][x];
+}
+
+// Scale2x (EPX): a pixel becomes 2x2, corners take a neighbour's color
+// where two neighbours meeting there agree
+static void scale2x(struct glyph *g) {
+    static struct glyph o;
+    int x, y, A, B, C, D, P;
+
+    if ((g->w * 2 > MAXW) || (g->h * 2 > MAXH)) fail("glyph too big");
+    o.w = g->w * 2;
+    o.h = g->h * 2;
+    for (y = 0; y < g->h; y++)
+        for (x = 0; x < g->w; x++) {
+            P = at(g, x, y);
+            A = at(g, x, y - 1);
+            B = at(g, x + 1, y);
+            C = at(g, x - 1, y);
+            D = at(g, x, y + 1);
+            o.p[2 * y][2 * x] = (C == A && C != D && A != B) ? A : P;
+            o.p[2 * y][2 * x + 1] = (A == B && A != C && B != D) ? B : P;
+            o.p[2 * y + 1][2 * x] = (D == C && D != B && C != A) ? C : P;
+            o.p[2 * y + 1][2 * x + 1] = (B == D && B != A && D != C) ? D : P;
+        }
+    *g = o;
+}
+
+// Scale3x (AdvMAME3x), the same idea at 3x3
+static void scale3x(struct glyph *g) {
+    static struct glyph o;
+    int x, y, A, B, C, D, E, F, G, H, I;
+    unsigned char *r0, *r1, *r2;
+
+    if ((g->w * 3 > MAXW) || (g->h * 3 > MAXH)) fail("glyph too big");
+    o.w = g->w * 3;
+    o.h = g->h * 3;
+    for (y = 0; y < g->h; y++)
+        for (x = 0; x < g->w; x++) {
+            A = at(g, x - 1, y - 1); B = at(g, x, y - 1); C = at(g, x + 1, y - 1);
+            D = at(g, x - 1, y);     E = at(g, x, y);     F = at(g, x + 1, y);
+            G = at(g, x - 1, y + 1); H = at(g, x, y + 1); I = at(g, x + 1, y + 1);
+            r0 = &o.p[3 * y][3 * x];
+            r1 = &o.p[3 * y + 1][3 * x];
+            r2 = &o.p[3 * y + 2][3 * x];
+            r0[0] = (D == B && D != H && B != F) ? D : E;
+            r0[1] = ((D == B && D != H && B != F && E != C) ||
+                     (B == F && B != D && F != H && E != A)) ? B : E;
+            r0[2] = (B == F && B != D && F != H) ? F : E;
+            r1[0] = ((D == B && D != H && B != F && E != G) ||
+                     (D == H && D != B && H != F && E != A)) ? D : E;
+            r1[1] = E;
+            r1[2] = ((B == F && B != D && F != H && E != I) ||
+                     (H == F && D != H && B != F && E != C)) ? F : E;
+            r2[0] = (D == H && D != B && H != F) ? D : E;
+            r2[1] = ((D == H && D != B && H != F && E != I) ||
+                     (H == F && D != H && B != F && E != G)) ? H : E;
+            r2[2] = (H == F && D != H && B != F) ? F : E;
+        }
+    *g = o;
+}
+
+static void enlarge(struct glyph *g, int scale) {
+    switch (scale) {
+    case 1: break;
+    case 2: scale2x(g); break;
+    case 3: scale3x(g); break;
+    case 4: scale2x(g); scale2x(g); break;
+    case 6: scale3x(g); scale2x(g); break;
+    case 8: scale2x(g); scale2x(g); scale2x(g); break;
+    default: fail("-glcd takes a scale of 1 to 4");
+    }
+}
+
+// every 2x2 block becomes one pixel, level 0..3 by how much of it is set
+static void halve(struct glyph *g) {
+    int x, y, n;
+
+    for (y = 0; y < (g->h + 1) / 2; y++)
+        for (x = 0; x < (g->w + 1) / 2; x++) {
+            n = at(g, 2 * x, 2 * y) + at(g, 2 * x + 1, 2 * y) +
+                at(g, 2 * x, 2 * y + 1) + at(g, 2 * x + 1, 2 * y + 1);
+            g->p[y][x] = n > 3 ? 3 : n;
+        }
+    for (y = (g->h + 1) / 2; y < g->h; y++) memset(g->p[y], 0, MAXW);
+    for (y = 0; y < g->h; y++) memset(g->p[y] + (g->w + 1) / 2, 0, MAXW - (g->w + 1) / 2);
+    g->w = (g->w + 1) / 2;
+    g->h = (g->h + 1) / 2;
+}
+
+// === sources ===========================================================
+// glcdfont.c glyph c, trimmed to its ink, one column of spacing after it
+static void glcd_glyph(int c, int scale, struct glyph *g) {
+    int lo = 5, hi = -1, x, y;
+
+    for (x = 0; x < 5; x++)
+        if (font[c * 5 + x]) {
+            if (lo > x) lo = x;
+            hi = x;
+        }
+    memset(g, 0, sizeof(*g));
+    g->h = 8;
+    if (hi < 0) {
+        // blank: as wide as a narrow letter
+        g->w = 3;
+    } else {
+        g->w = hi - lo + 2;
+        for (x = lo; x <= hi; x++)
+            for (y = 0; y < 8; y++)
+                g->p[y][x - lo] = (font[c * 5 + x] >> y) & 1;
+    }
+    enlarge(g, scale);
+}
+
+static void bdf_read(const char *path, int first, int last) {
+    FILE *f = fopen(path, "r");
+    char line[256];
+    int ascent = 0, descent = 0, enc = -1, dwidth = 0, bw = 0, bh = 0;
+    int bx = 0, by = 0, row = -1, x, y;
+    unsigned long bits;
+
+    if (!f) fail("cannot open the BDF font");
+    while (fgets(line, sizeof(line), f)) {
+        if (row >= 0) {
+            if (!strncmp(line, "ENDCHAR", 7)) {
+                row = -1;
+                continue;
+            }
+            if ((enc >= first) && (enc <= last)) {
+                // hex, msb first, padded to bytes
+                int nbytes = strspn(line, "0123456789abcdefABCDEF") / 2, b;
+                for (x = 0; x < bw; x++) {
+                    b = x / 8;
+                    if (b >= nbytes) break;
+                    sscanf(line + 2 * b, "%2lx", &bits);
+                    if (!(bits & (0x80 >> (x % 8)))) continue;
+                    y = ascent - (by + bh) + row;
+                    if ((bx + x >= 0) && (bx + x < MAXW) && (y >= 0) && (y < MAXH))
+                        glyphs[enc].p[y][bx + x] = 1;
+                }
+            }
+            row++;
+            continue;
+        }
+        if (!strncmp(line, "FONT_ASCENT ", 12)) ascent = atoi(line + 12);
+        else if (!strncmp(line, "FONT_DESCENT ", 13)) descent = atoi(line + 13);
+        else if (!strncmp(line, "ENCODING ", 9)) enc = atoi(line + 9);
+        else if (!strncmp(line, "DWIDTH ", 7)) dwidth = atoi(line + 7);
+        else if (!strncmp(line, "BBX ", 4))
+            sscanf(line + 4, "%d %d %d %d", &bw, &bh, &bx, &by);
+        else if (!strncmp(line, "BITMAP", 6)) {
+            row = 0;
+            if ((enc >= first) && (enc <= last) && (enc < 256)) {
+                if (dwidth > MAXW) fail("glyph too big");
+                glyphs[enc].w = dwidth;
+                glyphs[enc].h = ascent + descent;
+            }
+        }
+    }
+    fclose(f);
+    if ((ascent + descent <= 0) || (ascent + descent > MAXH))
+        fail("no FONT_ASCENT/FONT_DESCENT, or too tall");
+    height = ascent + descent;
+    for (enc = first; enc <= last; enc++) glyphs[enc].h = height;
+}
+
+// === output ============================================================
+int main(int argc, char **argv) {
+    const char *in = NULL, *outpath = NULL, *name = "font";
+    int aa = 0, scale = 0, first = ' ', last = '~', c, x, y, i, n;
+    unsigned long total = 0;
+    FILE *out = stdout;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-aa")) aa = 1;
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc) name = argv[++i];
+        else if (!strcmp(argv[i], "-r") && i + 1 < argc) {
+            if (sscanf(argv[++i], "%d-%d", &first, &last) != 2) fail("-r takes first-last");
+        } else if (!strcmp(argv[i], "-glcd") && i + 1 < argc) scale = atoi(argv[++i]);
+        else if (!in && !scale) in = argv[i];
+        else if (!outpath) outpath = argv[i];
+        else fail("too many arguments");
+    }
+    if ((!in && !scale) || (first < 0) || (last > 255) || (first > last)) {
+        fprintf(stderr, "usage: fontc [-aa] [-n name] [-r first-last] "
+                "font.bdf|-glcd scale [font.c]\n");
+        return 2;
+    }
+
+    if (scale) {
+        if ((scale < 1) || (scale > 4)) fail("-glcd takes a scale of 1 to 4");
+        for (c = first; c <= last; c++)
+            glcd_glyph(c, aa ? 2 * scale : scale, &glyphs[c]);
+        height = glyphs[first].h;
+    } else bdf_read(in, first, last);
+    if (aa) {
+        for (c = first; c <= last; c++) halve(&glyphs[c]);
+        height = (height + 1) / 2;
+    }
+
+    if (outpath && !(out = fopen(outpath, "w"))) fail("cannot write the C file");
+    fprintf(out, "// %s: '%c' to '%c', %d rows, %s\n", scale ? "glcdfont.c" : in,
+            first, last, height, aa ? "2bpp anti-aliased" : "1bpp");
+    if (scale) fprintf(out, "// glyphs trimmed to their ink and enlarged %dx\n", scale);
+    fprintf(out, "// made by host/fontc.c, do not edit\n\n");
+    fprintf(out, "#include \"tft_font.h\"\n\n");
+
+    fprintf(out, "static const unsigned char %s_width[%d] = {", name, last - first + 1);
+    for (c = first; c <= last; c++)
+        fprintf(out, "%s%d,", (c - first) % 16 ? " " : "\n    ", glyphs[c].w);
+    fprintf(out, "\n};\n\n");
+    fprintf(out, "static const unsigned short %s_offset[%d] = {", name, last - first + 1);
+    for (c = first; c <= last; c++) {
+        fprintf(out, "%s%lu,", (c - first) % 12 ? " " : "\n    ", total);
+        total += (unsigned long)height * ((glyphs[c].w * (aa ? 2 : 1) + 7) / 8);
+    }
+    fprintf(out, "\n};\n\n");
+    if (total > 65535) fail("more than 64K of glyph data");
+
+    fprintf(out, "static const unsigned char %s_data[%lu] = {\n", name, total);
+    for (c = first; c <= last; c++) {
+        fprintf(out, "    // '%c'\n", c);
+        for (y = 0; y < height; y++) {
+            unsigned char b = 0;
+            fprintf(out, "   ");
+            for (x = 0, n = 0; x < glyphs[c].w; x++) {
+                if (aa) b |= glyphs[c].p[y][x] << (6 - 2 * (x % 4));
+                else    b |= glyphs[c].p[y][x] << (7 - x % 8);
+                if ((x % (aa ? 4 : 8)) == (aa ? 3 : 7) || x == glyphs[c].w - 1) {
+                    fprintf(out, " 0x%02x,", b);
+                    b = 0;
+                    n++;
+                }
+            }
+            fprintf(out, "\n");
+        }
+    }
+    fprintf(out, "};\n\n");
+    fprintf(out, "const struct tft_font %s = {\n    %d, %d, %d, %d,\n"
+            "    %s_width, %s_offset, %s_data\n};\n", name, first, last,
+            height, aa ? 2 : 1, name, name, name);
+    if (out != stdout) fclose(out);
+    fprintf(stderr, "fontc: %s, %d glyphs %d rows high, %lu bytes\n", name,
+            last - first + 1, height, total + 3 * (last - first + 1));
+    return 0;
+}
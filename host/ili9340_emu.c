@@ -0,0 +1,270 @@
+/*
+ * File:   ili9340_emu.c
+ *
+ * Byte-level ILI9340 model: CASET/PASET set the window, RAMWR streams
+ * RGB565 pixels into it, wrapping column then page like the panel.
+ * MADCTL decides where a (column, page) address lands on the glass:
+ * MV exchanges the two, MX and MY mirror them, BGR clear swaps red and
+ * blue. The Adafruit module is mounted mirrored, so MX is what gives an
+ * upright picture in rotation 0 (see tft_setRotation()).
+ * VSCRDEF/VSCRSADD only change which GRAM row each screen row shows.
+ * SWRESET puts all of that back to the power-on state.
+ * Bytes sent with CS high are ignored.
+ */
+
+#include "plib.h"
+#include "ili9340_emu.h"
+
+#define CMD_SWRESET 0x01
+#define CMD_CASET 0x2A
+#define CMD_PASET 0x2B
+#define CMD_RAMWR 0x2C
+#define CMD_VSCRDEF  0x33
+#define CMD_MADCTL   0x36
+#define CMD_VSCRSADD 0x37
+
+#define MADCTL_MY  0x80
+#define MADCTL_MX  0x40
+#define MADCTL_MV  0x20
+#define MADCTL_BGR 0x08
+
+unsigned short emu_frame[EMU_HEIGHT][EMU_WIDTH];
+int emu_tfa = 0, emu_vsa = EMU_HEIGHT, emu_vsp = 0;
+unsigned char emu_madctl = 0;
+struct emu_stats emu;
+
+static unsigned char cmd, args[6];
+static int nargs;
+static int sc, ec = EMU_WIDTH - 1, sp, ep = EMU_HEIGHT - 1;
+static int cx, cy, half;
+static unsigned short pixel;
+static int last_bits;
+
+// store a pixel at column address c, page address p
+static void emu_plot(int c, int p, unsigned short color) {
+    int a, b;
+
+    if (emu_madctl & MADCTL_MV) { a = p; b = c; }
+    else                        { a = c; b = p; }
+    if (a >= EMU_WIDTH || b >= EMU_HEIGHT) return;
+    if (!(emu_madctl & MADCTL_MX)) a = EMU_WIDTH - 1 - a;
+    if (emu_madctl & MADCTL_MY) b = EMU_HEIGHT - 1 - b;
+    if (!(emu_madctl & MADCTL_BGR))
+        color = (color << 11) | (color & 0x07e0) | (color >> 11);
+    emu_frame[b][a] = color;
+    emu.pixels++;
+}
+
+static void emu_byte(unsigned char b, int dc) {
+    if (!dc) {
+        cmd = b;
+        nargs = 0;
+        emu.commands++;
+        if (cmd == CMD_RAMWR) {
+            cx = sc;
+            cy = sp;
+            half = 0;
+        } else if (cmd == CMD_SWRESET) {
+            emu_madctl = 0;
+            emu_tfa = 0;
+            emu_vsa = EMU_HEIGHT;
+            emu_vsp = 0;
+        }
+        return;
+    }
+    switch (cmd) {
+    case CMD_CASET:
+    case CMD_PASET:
+        if (nargs < 4) args[nargs++] = b;
+        if (nargs == 4) {
+            if (cmd == CMD_CASET) {
+                sc = (args[0] << 8) | args[1];
+                ec = (args[2] << 8) | args[3];
+            } else {
+                sp = (args[0] << 8) | args[1];
+                ep = (args[2] << 8) | args[3];
+            }
+        }
+        break;
+    case CMD_VSCRDEF:
+        if (nargs < 6) args[nargs++] = b;
+        if (nargs == 6) {
+            emu_tfa = (args[0] << 8) | args[1];
+            emu_vsa = (args[2] << 8) | args[3];
+        }
+        break;
+    case CMD_MADCTL:
+        if (nargs++ == 0) emu_madctl = b;
+        break;
+    case CMD_VSCRSADD:
+        if (nargs < 2) args[nargs++] = b;
+        if (nargs == 2) emu_vsp = (args[0] << 8) | args[1];
+        break;
+    case CMD_RAMWR:
+        pixel = (pixel << 8) | b;
+        if (++half < 2) break;
+        half = 0;
+        emu_plot(cx, cy, pixel);
+        if (++cx > ec) {
+            cx = sc;
+            if (++cy > ep) cy = sp;
+        }
+        break;
+    }
+}
+
+static void emu_word(unsigned int word, int bits, int dc, int cs) {
+    if (bits == 8)       emu.words8++;
+    else if (bits == 16) emu.words16++;
+    else                 emu.words32++;
+    if (last_bits && bits != last_bits) emu.mode_switches++;
+    last_bits = bits;
+    if (cs) {
+        emu.dropped += bits / 8;
+        return;
+    }
+    emu.bytes += bits / 8;
+    while (bits > 0) {
+        bits -= 8;
+        emu_byte((word >> bits) & 0xff, dc);
+    }
+}
+
+static void emu_pins(unsigned int old, unsigned int now) {
+    if ((old ^ now) & 2) emu.cs_toggles++;
+    if ((old ^ now) & 1) emu.dc_toggles++;
+}
+
+void emu_attach(void) {
+    sim_spi1_hook = emu_word;
+    sim_latb_hook = emu_pins;
+}
+
+void emu_reset_stats(void) {
+    memset(&emu, 0, sizeof(emu));
+    last_bits = 0;
+}
+
+int emu_scroll_row(int y) {
+    // screen rows in the scroll area start at GRAM row emu_vsp and wrap
+    // within it; the fixed areas above and below show their own rows
+    if (y < emu_tfa || y >= emu_tfa + emu_vsa) return y;
+    return emu_tfa + (y - emu_tfa + emu_vsp - emu_tfa + emu_vsa) % emu_vsa;
+}
+
+void emu_screen(unsigned short out[EMU_HEIGHT][EMU_WIDTH]) {
+    int y;
+    for (y = 0; y < EMU_HEIGHT; y++)
+        memcpy(out[y], emu_frame[emu_scroll_row(y)], sizeof(out[y]));
+}
+
+// one screen row as 8-bit RGB
+static void emu_rgb_row(int y, unsigned char *out) {
+    int x;
+    for (x = 0; x < EMU_WIDTH; x++) {
+        unsigned short c = emu_frame[emu_scroll_row(y)][x];
+        *out++ = ((c >> 11) & 0x1f) * 255 / 31;
+        *out++ = ((c >> 5) & 0x3f) * 255 / 63;
+        *out++ = (c & 0x1f) * 255 / 31;
+    }
+}
+
+int emu_write_ppm(const char *path) {
+    FILE *f = fopen(path, "wb");
+    unsigned char row[EMU_WIDTH * 3];
+    int y;
+    if (!f) return -1;
+    fprintf(f, "P6\n%d %d\n255\n", EMU_WIDTH, EMU_HEIGHT);
+    for (y = 0; y < EMU_HEIGHT; y++) {
+        emu_rgb_row(y, row);
+        fwrite(row, 1, sizeof(row), f);
+    }
+    return fclose(f);
+}
+
+// === PNG: zlib stream of stored (uncompressed) deflate blocks =========
+static unsigned long crc_table[256];
+
+static unsigned long png_crc(unsigned long crc, const unsigned char *p,
+        unsigned long n) {
+    if (!crc_table[1]) {
+        unsigned long c;
+        int i, k;
+        for (i = 0; i < 256; i++) {
+            for (c = i, k = 0; k < 8; k++)
+                c = c & 1 ? 0xedb88320UL ^ (c >> 1) : c >> 1;
+            crc_table[i] = c;
+        }
+    }
+    crc ^= 0xffffffffUL;
+    while (n--) crc = crc_table[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+    return crc ^ 0xffffffffUL;
+}
+
+static unsigned char *put32(unsigned char *p, unsigned long v) {
+    *p++ = v >> 24;
+    *p++ = v >> 16;
+    *p++ = v >> 8;
+    *p++ = v;
+    return p;
+}
+
+static void png_chunk(FILE *f, const char *type, const unsigned char *data,
+        unsigned long n) {
+    unsigned char b[4];
+    unsigned long crc = png_crc(0, (const unsigned char *)type, 4);
+
+    put32(b, n);
+    fwrite(b, 1, 4, f);
+    fwrite(type, 1, 4, f);
+    fwrite(data, 1, n, f);
+    put32(b, png_crc(crc, data, n));
+    fwrite(b, 1, 4, f);
+}
+
+int emu_write_png(const char *path) {
+    static const unsigned char sig[8] = { 137, 'P', 'N', 'G', 13, 10, 26, 10 };
+    // each row: filter type 0, then RGB
+    enum { ROW = 1 + EMU_WIDTH * 3, RAW = ROW * EMU_HEIGHT,
+           BLOCK = 65535, BLOCKS = (RAW + BLOCK - 1) / BLOCK };
+    static unsigned char raw[RAW];
+    static unsigned char idat[2 + RAW + 5 * BLOCKS + 4];
+    unsigned char hdr[13], *p = idat;
+    unsigned long a = 1, b = 0, i, n;
+    FILE *f = fopen(path, "wb");
+    int y;
+
+    if (!f) return -1;
+    for (y = 0; y < EMU_HEIGHT; y++) {
+        raw[y * ROW] = 0;
+        emu_rgb_row(y, raw + y * ROW + 1);
+    }
+    *p++ = 0x78;    // deflate, 32K window
+    *p++ = 0x01;
+    for (i = 0; i < RAW; i += n) {
+        n = RAW - i < BLOCK ? RAW - i : BLOCK;
+        *p++ = i + n == RAW;    // BFINAL on the last block, BTYPE 00
+        *p++ = n;
+        *p++ = n >> 8;
+        *p++ = ~n;
+        *p++ = ~n >> 8;
+        memcpy(p, raw + i, n);
+        p += n;
+    }
+    for (i = 0; i < RAW; i++) {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    p = put32(p, (b << 16) | a);
+
+    put32(hdr, EMU_WIDTH);
+    put32(hdr + 4, EMU_HEIGHT);
+    hdr[8] = 8;     // bit depth
+    hdr[9] = 2;     // truecolor
+    hdr[10] = hdr[11] = hdr[12] = 0;
+    fwrite(sig, 1, sizeof(sig), f);
+    png_chunk(f, "IHDR", hdr, sizeof(hdr));
+    png_chunk(f, "IDAT", idat, p - idat);
+    png_chunk(f, "IEND", NULL, 0);
+    return fclose(f);
+}
@@ -0,0 +1,45 @@
+/*
+ * File:   ili9340_emu.h
+ *
+ * ILI9340 panel emulator for the host build.  Listens to the words
+ * leaving SPI1 and the port B pins in sim_pic32.c (sim_spi1_hook and
+ * sim_latb_hook) and keeps the 240x320 RGB565 frame the panel would
+ * show, along with counts of what crossed the wire.
+ */
+
+#ifndef ILI9340_EMU_H
+#define ILI9340_EMU_H
+
+#define EMU_WIDTH  240
+#define EMU_HEIGHT 320
+
+// GRAM contents as seen on the glass (portrait, MADCTL applied), in
+// GRAM row order
+extern unsigned short emu_frame[EMU_HEIGHT][EMU_WIDTH];
+// vertical scroll state: top fixed rows, scroll area rows, GRAM row at
+// the top of the scroll area
+extern int emu_tfa, emu_vsa, emu_vsp;
+// last MADCTL argument
+extern unsigned char emu_madctl;
+
+// what went over the wire, cleared by emu_reset_stats()
+struct emu_stats {
+    unsigned long words8, words16, words32; // SPI words by width
+    unsigned long mode_switches;    // width changes between two words
+    unsigned long cs_toggles, dc_toggles;   // pin edges
+    unsigned long bytes;            // bytes the panel took (CS low)
+    unsigned long dropped;          // bytes sent with CS high
+    unsigned long commands;         // command bytes (D/C low)
+    unsigned long pixels;           // RAMWR pixels that hit the glass
+};
+extern struct emu_stats emu;
+
+void emu_attach(void);
+void emu_reset_stats(void);
+int  emu_scroll_row(int y);     // GRAM row shown on screen row y
+void emu_screen(unsigned short out[EMU_HEIGHT][EMU_WIDTH]);
+// snapshots of what the screen shows, 0 on success
+int  emu_write_ppm(const char *path);
+int  emu_write_png(const char *path);
+
+#endif /* ILI9340_EMU_H */
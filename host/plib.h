@@ -0,0 +1,227 @@
+/*
+ * File:   plib.h  (host stand-in)
+ *
+ * Host-side replacement for the subset of the PIC32 peripheral library
+ * that tft_master.c and tft_gfx.c touch.  Found instead of the real
+ * plib.h when the build adds -Ihost.  Register reads go through the
+ * simulator in sim_pic32.c so that SPI1 busy flags, the SPI1 transmit
+ * buffer and the DMA controller advance a shared cycle clock.
+ *
+ * The SET/CLR register trick: "LATBSET = 2;" expands to
+ * "*sim_reg_op(&LATB, SIM_OP_SET) = 2;".  The store lands in a pending
+ * slot which the simulator applies on its next entry, before any time
+ * passes, so ordering against SPI writes is preserved.
+ */
+
+#ifndef SIM_PLIB_H
+#define SIM_PLIB_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+// === simulator core ==================================================
+// all times are in system clock cycles (sys_clock == PBCLK == 40 MHz)
+typedef unsigned long long sim_time_t;
+
+#define SIM_OP_SET 0
+#define SIM_OP_CLR 1
+#define SIM_OP_INV 2
+
+extern volatile unsigned int *sim_reg_op(volatile unsigned int *reg, int op);
+extern void sim_asm(const char *insn);
+extern void sim_idle(unsigned int cycles);
+// cpu busy on work that touches no register (loops over RAM buffers),
+// charged by a benchmark's own estimate
+extern void sim_work(unsigned int cycles);
+extern void sim_reset(void);
+
+// bus and cpu counters, cleared by sim_reset()
+struct sim_counters {
+    sim_time_t cycles;          // foreground cpu clock
+    sim_time_t idle_cycles;     // time handed to other work via sim_idle()
+    sim_time_t isr_cycles;      // time stolen by simulated interrupts
+    sim_time_t bus_cycles;      // time SCK was running
+    unsigned long words8, words16, words32; // SPI words by width
+    unsigned long dma_cells;    // SPI words written by the DMA
+    unsigned long polls;        // busy/full status reads
+    unsigned long overruns;     // writes dropped on a full tx buffer
+    unsigned long hazards;      // CS/DC/mode changed while the bus was busy
+    unsigned long mode_flips;   // SPI1 word width changes
+    unsigned long gaps;         // times the bus ran dry between two words
+    sim_time_t gap_cycles;      // and for how long in total
+};
+extern struct sim_counters sim;
+extern sim_time_t sim_now(void);
+
+// optional observers, the seam a panel model plugs into: every word
+// that reaches the SPI1 shifter, and every change of the port B latch
+// (D/C, CS and RST of tft_master.h)
+extern void (*sim_spi1_hook)(unsigned int word, int bits, int dc, int cs);
+extern void (*sim_latb_hook)(unsigned int old, unsigned int now);
+
+// === asm("nop") costs one cycle ======================================
+#define asm(s) sim_asm(s)
+
+// === interrupts ======================================================
+#define __ISR(v, ipl)
+#define ipl1 1
+#define ipl2 2
+#define ipl3 3
+#define ipl4 4
+#define ipl5 5
+#define ipl6 6
+#define ipl7 7
+
+#define INT_DMA0 0
+#define INT_DMA1 1
+#define INT_DMA2 2
+#define INT_DMA3 3
+#define INT_DMA_0_VECTOR 0
+#define INT_DMA_1_VECTOR 1
+#define INT_DMA_2_VECTOR 2
+#define INT_DMA_3_VECTOR 3
+#define INT_ENABLED  1
+#define INT_DISABLED 0
+#define INT_PRIORITY_LEVEL_1 1
+#define INT_PRIORITY_LEVEL_2 2
+#define INT_PRIORITY_LEVEL_3 3
+#define INT_PRIORITY_LEVEL_4 4
+#define INT_PRIORITY_LEVEL_5 5
+#define INT_PRIORITY_LEVEL_6 6
+#define INT_PRIORITY_LEVEL_7 7
+#define INT_SUB_PRIORITY_LEVEL_0 0
+
+void INTEnable(int src, int enable);
+void INTClearFlag(int src);
+void INTSetVectorPriority(int vec, int pri);
+void INTSetVectorSubPriority(int vec, int sub);
+void INTEnableSystemMultiVectoredInt(void);
+
+// vector handlers the simulator dispatches DMA block interrupts to
+extern void DMA0Handler(void) __attribute__((weak));
+extern void DMA1Handler(void) __attribute__((weak));
+extern void DMA2Handler(void) __attribute__((weak));
+extern void DMA3Handler(void) __attribute__((weak));
+
+// === port B ==========================================================
+extern volatile unsigned int LATB, TRISB, ANSELA, ANSELB, RPB11R;
+#define LATBSET (*sim_reg_op(&LATB, SIM_OP_SET))
+#define LATBCLR (*sim_reg_op(&LATB, SIM_OP_CLR))
+#define LATBINV (*sim_reg_op(&LATB, SIM_OP_INV))
+typedef struct {
+    unsigned LATB0:1, LATB1:1, LATB2:1, LATB3:1;
+} sim_latb_bits;
+typedef struct {
+    unsigned TRISB0:1, TRISB1:1, TRISB2:1, TRISB3:1;
+} sim_trisb_bits;
+extern sim_latb_bits LATBbits;
+extern sim_trisb_bits TRISBbits;
+
+// === SPI1 ============================================================
+extern volatile unsigned int SPI1CON, SPI1BUF, SPI1BRG;
+#define SPI1CONSET (*sim_reg_op(&SPI1CON, SIM_OP_SET))
+#define SPI1CONCLR (*sim_reg_op(&SPI1CON, SIM_OP_CLR))
+typedef struct {
+    unsigned SPIRBF:1, SPITBF:1, :1, SPITBE:1, :1, SPIRBE:1, SPIROV:1,
+             SRMT:1, SPITUR:1, :2, SPIBUSY:1, :4, TXBUFELM:5, :3,
+             RXBUFELM:5;
+} sim_spistat_bits;
+extern sim_spistat_bits *sim_spi1stat(void);
+extern unsigned int sim_spi1stat_word(void);
+#define SPI1STATbits (*sim_spi1stat())
+#define SPI1STAT     (sim_spi1stat_word())
+
+extern void WriteSPI1(unsigned int data);
+extern int  TxBufFullSPI1(void);
+
+typedef enum { SPI_CHANNEL1 = 1, SPI_CHANNEL2 = 2 } SpiChannel;
+#define SPI_OPEN_MSTEN    0x00000020
+#define SPI_OPEN_DISSDI   0x00000010
+#define SPI_OPEN_CKE_REV  0x00000100
+#define SPI_OPEN_MODE8    0x00000000
+#define SPI_OPEN_MODE16   0x00000400
+#define SPI_OPEN_MODE32   0x00000800
+#define SPI_OPEN_ON       0x00008000
+void SpiChnOpen(int chn, unsigned int flags, unsigned int srcClkDiv);
+
+// === DMA =============================================================
+typedef enum {
+    DMA_CHANNEL0 = 0, DMA_CHANNEL1, DMA_CHANNEL2, DMA_CHANNEL3
+} DmaChannel;
+#define DMA_CHN_PRI0 0
+#define DMA_CHN_PRI1 1
+#define DMA_CHN_PRI2 2
+#define DMA_CHN_PRI3 3
+#define DMA_OPEN_DEFAULT 0
+#define DMA_OPEN_AUTO    0x10
+#define DMA_OPEN_MATCH   0x800
+#define DMA_EV_BLOCK_DONE   0x08
+#define DMA_EV_CELL_DONE    0x04
+#define DMA_EV_START_IRQ_EN 0x10
+#define DMA_EV_MATCH_EN     0x20
+#define DMA_EV_START_IRQ(irq) (((irq) & 0xff) << 8)
+#define _SPI1_TX_IRQ 37
+#define _UART2_RX_IRQ 54
+#define _UART2_TX_IRQ 55
+
+void DmaChnOpen(int chn, int pri, int oflags);
+void DmaChnSetTxfer(int chn, const void *vSrcAdd, void *vDstAdd,
+                    int srcSize, int dstSize, int cellSize);
+void DmaChnSetEventControl(int chn, unsigned int flags);
+void DmaChnSetEvEnableFlags(int chn, unsigned int flags);
+void DmaChnClrEvFlags(int chn, unsigned int flags);
+unsigned int DmaChnGetEvFlags(int chn);
+void DmaChnEnable(int chn);
+void DmaChnDisable(int chn);
+
+// === core timer ======================================================
+unsigned int ReadCoreTimer(void);
+void WriteCoreTimer(unsigned int t);
+
+// === timer 1, UART2 and the rest of what pt_cornell_1_3_2.h touches ==
+// declarations only: host/pt_bench.c gives them bodies (a UART and
+// DMA1 fed from its own timer tick) and calls Timer1Handler() itself
+#define T1_ON           0x8000
+#define T1_SOURCE_INT   0
+#define T1_PS_1_1       0
+#define T1_INT_ON       0x8
+#define T1_INT_PRIOR_2  2
+#define mT1ClearIntFlag()
+void OpenTimer1(unsigned int config, unsigned int period);
+void ConfigIntTimer1(unsigned int config);
+
+#define SYS_CFG_WAIT_STATES 1
+#define SYS_CFG_PCACHE      2
+void SYSTEMConfig(unsigned int sys_clock_hz, unsigned int flags);
+
+#define PPSInput(grp, fn, pin)
+#define PPSOutput(grp, pin, fn)
+
+#define UART2 2
+#define UART_ENABLE_PINS_TX_RX_ONLY 0
+#define UART_DATA_SIZE_8_BITS 0
+#define UART_PARITY_NONE      0
+#define UART_STOP_BITS_1      0
+#define UART_PERIPHERAL 1
+#define UART_RX         2
+#define UART_TX         4
+#define UART_ENABLE_FLAGS(f) (f)
+extern volatile unsigned int U2RXREG, U2TXREG, U2STA;
+void UARTConfigure(int uart, int flags);
+void UARTSetLineControl(int uart, int flags);
+void UARTSetDataRate(int uart, unsigned int pb_hz, unsigned int baud);
+void UARTEnable(int uart, int flags);
+int UARTReceivedDataIsAvailable(int uart);
+int UARTTransmitterIsReady(int uart);
+unsigned char UARTGetDataByte(int uart);
+void UARTSendDataByte(int uart, unsigned char c);
+void DmaChnSetMatchPattern(int chn, unsigned int pattern);
+
+// UART2 RX wake-up and the interrupt-off brackets around pt_ready
+#define INT_U2RX 8
+#define INT_UART_2_VECTOR 8
+unsigned int INTDisableInterrupts(void);
+void INTRestoreInterrupts(unsigned int status);
+
+#endif /* SIM_PLIB_H */
@@ -0,0 +1,535 @@
+/*
+ * File:   png2bitmap.c
+ *
+ * Host tool: turn a PNG into a struct tft_bitmap (see tft_bitmap.h) as C
+ * source, so images can be regenerated whenever the artwork changes.
+ *
+ * Build and run from the repo root:
+ *   gcc -O2 -o png2bitmap host/png2bitmap.c
+ *   ./png2bitmap [-f 1|4|rle] [-n name] image.png [image.c]
+ *
+ * Colors are reduced to RGB565; pixels with alpha below 128 become the
+ * see-through key. More than 16 colors (2 for -f 1) are merged, closest
+ * pair first. Without -f the smallest format that fits is taken. The C
+ * goes to image.c, or to stdout.
+ *
+ * Any non-interlaced PNG will do: gray, RGB, palette, with or without
+ * alpha, 1 to 16 bits.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../tft_bitmap.h"
+
+static void fail(const char *msg) {
+    fprintf(stderr, "png2bitmap: %s\n", msg);
+    exit(1);
+}
+
+// === inflate (RFC 1951), after zlib's puff.c =========================
+struct inf {
+    const unsigned char *in;
+    unsigned long inlen, inpos;
+    unsigned long bitbuf;
+    int bitcnt;
+    unsigned char *out;
+    unsigned long outlen, outpos;
+};
+
+struct huff {
+    short count[16];        // codes of each length
+    short symbol[288];      // symbols by code
+};
+
+static int inf_bits(struct inf *s, int need) {
+    unsigned long val = s->bitbuf;
+
+    while (s->bitcnt < need) {
+        if (s->inpos >= s->inlen) fail("truncated image data");
+        val |= (unsigned long)s->in[s->inpos++] << s->bitcnt;
+        s->bitcnt += 8;
+    }
+    s->bitbuf = val >> need;
+    s->bitcnt -= need;
+    return val & ((1UL << need) - 1);
+}
+
+static void inf_put(struct inf *s, unsigned char c) {
+    if (s->outpos >= s->outlen) fail("too much image data");
+    s->out[s->outpos++] = c;
+}
+
+static void inf_stored(struct inf *s) {
+    unsigned long len;
+
+    s->bitbuf = 0;
+    s->bitcnt = 0;
+    if (s->inpos + 4 > s->inlen) fail("truncated image data");
+    len = s->in[s->inpos] | (s->in[s->inpos + 1] << 8);
+    if ((s->in[s->inpos + 2] != (~len & 0xff)) ||
+        (s->in[s->inpos + 3] != ((~len >> 8) & 0xff)))
+        fail("bad stored block");
+    s->inpos += 4;
+    if (s->inpos + len > s->inlen) fail("truncated image data");
+    while (len--) inf_put(s, s->in[s->inpos++]);
+}
+
+static int inf_decode(struct inf *s, const struct huff *h) {
+    int len, code = 0, first = 0, index = 0, count;
+
+    for (len = 1; len < 16; len++) {
+        code |= inf_bits(s, 1);
+        count = h->count[len];
+        if (code - count < first) return h->symbol[index + (code - first)];
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    fail("bad Huffman code");
+    return -1;
+}
+
+static void inf_construct(struct huff *h, const short *length, int n) {
+    short offs[16];
+    int len, sym;
+
+    memset(h->count, 0, sizeof(h->count));
+    for (sym = 0; sym < n; sym++) h->count[length[sym]]++;
+    offs[1] = 0;
+    for (len = 1; len < 15; len++) offs[len + 1] = offs[len] + h->count[len];
+    for (sym = 0; sym < n; sym++)
+        if (length[sym]) h->symbol[offs[length[sym]]++] = sym;
+}
+
+static void inf_codes(struct inf *s, const struct huff *lencode,
+        const struct huff *distcode) {
+    static const short lbase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15,
+        17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195,
+        227, 258 };
+    static const short lext[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2,
+        2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const short dbase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33,
+        49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073,
+        4097, 6145, 8193, 12289, 16385, 24577 };
+    static const short dext[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5,
+        5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+    int sym, len;
+    unsigned long dist;
+
+    while ((sym = inf_decode(s, lencode)) != 256) {
+        if (sym < 256) {
+            inf_put(s, sym);
+            continue;
+        }
+        sym -= 257;
+        if (sym >= 29) fail("bad length code");
+        len = lbase[sym] + inf_bits(s, lext[sym]);
+        sym = inf_decode(s, distcode);
+        if (sym >= 30) fail("bad distance code");
+        dist = dbase[sym] + inf_bits(s, dext[sym]);
+        if (dist > s->outpos) fail("distance too far back");
+        while (len--) inf_put(s, s->out[s->outpos - dist]);
+    }
+}
+
+static void inf_fixed(struct inf *s) {
+    static struct huff lencode, distcode;
+    static int built;
+    short lengths[288];
+    int sym;
+
+    if (!built) {
+        for (sym = 0; sym < 144; sym++) lengths[sym] = 8;
+        for (; sym < 256; sym++) lengths[sym] = 9;
+        for (; sym < 280; sym++) lengths[sym] = 7;
+        for (; sym < 288; sym++) lengths[sym] = 8;
+        inf_construct(&lencode, lengths, 288);
+        for (sym = 0; sym < 30; sym++) lengths[sym] = 5;
+        inf_construct(&distcode, lengths, 30);
+        built = 1;
+    }
+    inf_codes(s, &lencode, &distcode);
+}
+
+static void inf_dynamic(struct inf *s) {
+    static const short order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11,
+        4, 12, 3, 13, 2, 14, 1, 15 };
+    struct huff lencode, distcode;
+    short lengths[320];
+    int nlen, ndist, ncode, index, sym, len;
+
+    nlen = inf_bits(s, 5) + 257;
+    ndist = inf_bits(s, 5) + 1;
+    ncode = inf_bits(s, 4) + 4;
+    if ((nlen > 286) || (ndist > 30)) fail("bad dynamic block");
+    memset(lengths, 0, sizeof(lengths));
+    for (index = 0; index < ncode; index++)
+        lengths[order[index]] = inf_bits(s, 3);
+    inf_construct(&lencode, lengths, 19);
+
+    for (index = 0; index < nlen + ndist; ) {
+        sym = inf_decode(s, &lencode);
+        if (sym < 16) {
+            lengths[index++] = sym;
+            continue;
+        }
+        len = 0;
+        if (sym == 16) {
+            if (!index) fail("bad dynamic block");
+            len = lengths[index - 1];
+            sym = 3 + inf_bits(s, 2);
+        } else if (sym == 17) sym = 3 + inf_bits(s, 3);
+        else sym = 11 + inf_bits(s, 7);
+        if (index + sym > nlen + ndist) fail("bad dynamic block");
+        while (sym--) lengths[index++] = len;
+    }
+    inf_construct(&lencode, lengths, nlen);
+    inf_construct(&distcode, lengths + nlen, ndist);
+    inf_codes(s, &lencode, &distcode);
+}
+
+// unpack a zlib stream into out[0..outlen-1]
+static void inflate_zlib(const unsigned char *in, unsigned long inlen,
+        unsigned char *out, unsigned long outlen) {
+    struct inf s;
+    int last, type;
+
+    if ((inlen < 2) || ((in[0] & 15) != 8) || ((in[0] << 8 | in[1]) % 31))
+        fail("image data is not a zlib stream");
+    memset(&s, 0, sizeof(s));
+    s.in = in;
+    s.inlen = inlen;
+    s.inpos = 2;
+    s.out = out;
+    s.outlen = outlen;
+    do {
+        last = inf_bits(&s, 1);
+        type = inf_bits(&s, 2);
+        if (type == 0) inf_stored(&s);
+        else if (type == 1) inf_fixed(&s);
+        else if (type == 2) inf_dynamic(&s);
+        else fail("bad block type");
+    } while (!last);
+    if (s.outpos != outlen) fail("too little image data");
+}
+
+// === PNG ===============================================================
+static unsigned long get32(const unsigned char *p) {
+    return ((unsigned long)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static unsigned char paeth(int a, int b, int c) {
+    int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+
+    if ((pa <= pb) && (pa <= pc)) return a;
+    return (pb <= pc) ? b : c;
+}
+
+// read a PNG into 8-bit RGBA, w*h*4 bytes
+static unsigned char *png_read(const char *path, int *pw, int *ph) {
+    FILE *f = fopen(path, "rb");
+    unsigned char *file, *idat, *raw, *rgba, *row, *prev;
+    unsigned char plte[256][3], trns[256];
+    long size;
+    unsigned long pos = 8, len, nidat = 0, stride, rawlen;
+    int w = 0, h = 0, depth = 0, ctype = -1, chans, bpp, x, y, i, c;
+    int ntrns = 0, trns_gray = -1, trns_rgb[3] = { -1, -1, -1 };
+
+    if (!f) fail("cannot open the PNG");
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    file = malloc(size);
+    idat = malloc(size);
+    if (!file || !idat || (fread(file, 1, size, f) != (size_t)size))
+        fail("cannot read the PNG");
+    fclose(f);
+    if ((size < 8) || memcmp(file, "\211PNG\r\n\032\n", 8)) fail("not a PNG");
+    memset(trns, 255, sizeof(trns));
+
+    while (pos + 12 <= (unsigned long)size) {
+        const unsigned char *d = file + pos + 8;
+        len = get32(file + pos);
+        if (pos + 12 + len > (unsigned long)size) fail("truncated chunk");
+        if (!memcmp(file + pos + 4, "IHDR", 4)) {
+            w = get32(d);
+            h = get32(d + 4);
+            depth = d[8];
+            ctype = d[9];
+            if (d[12]) fail("interlaced PNGs are not supported");
+        } else if (!memcmp(file + pos + 4, "PLTE", 4)) {
+            memcpy(plte, d, len < sizeof(plte) ? len : sizeof(plte));
+        } else if (!memcmp(file + pos + 4, "tRNS", 4)) {
+            if (ctype == 3) {
+                ntrns = len < 256 ? len : 256;
+                memcpy(trns, d, ntrns);
+            } else if (ctype == 0) trns_gray = (d[0] << 8) | d[1];
+            else if (ctype == 2)
+                for (i = 0; i < 3; i++) trns_rgb[i] = (d[2 * i] << 8) | d[2 * i + 1];
+        } else if (!memcmp(file + pos + 4, "IDAT", 4)) {
+            memcpy(idat + nidat, d, len);
+            nidat += len;
+        } else if (!memcmp(file + pos + 4, "IEND", 4)) break;
+        pos += 12 + len;
+    }
+    if ((w <= 0) || (h <= 0)) fail("no IHDR chunk");
+    switch (ctype) {
+    case 0: chans = 1; break;
+    case 2: chans = 3; break;
+    case 3: chans = 1; break;
+    case 4: chans = 2; break;
+    case 6: chans = 4; break;
+    default: fail("bad color type"); return NULL;
+    }
+
+    // unfilter, in place
+    stride = ((unsigned long)w * chans * depth + 7) / 8;
+    bpp = (chans * depth + 7) / 8;
+    rawlen = (stride + 1) * h;
+    raw = malloc(rawlen);
+    rgba = malloc((unsigned long)w * h * 4);
+    if (!raw || !rgba) fail("out of memory");
+    inflate_zlib(idat, nidat, raw, rawlen);
+    for (y = 0; y < h; y++) {
+        row = raw + y * (stride + 1) + 1;
+        prev = y ? row - (stride + 1) : NULL;
+        for (i = 0; i < (int)stride; i++) {
+            int a = i >= bpp ? row[i - bpp] : 0, b = prev ? prev[i] : 0;
+            int cc = (prev && i >= bpp) ? prev[i - bpp] : 0;
+            switch (row[-1]) {
+            case 0: break;
+            case 1: row[i] += a; break;
+            case 2: row[i] += b; break;
+            case 3: row[i] += (a + b) / 2; break;
+            case 4: row[i] += paeth(a, b, cc); break;
+            default: fail("bad filter type");
+            }
+        }
+    }
+
+    // samples to RGBA
+    for (y = 0; y < h; y++) {
+        row = raw + y * (stride + 1) + 1;
+        for (x = 0; x < w; x++) {
+            unsigned char *o = rgba + ((unsigned long)y * w + x) * 4;
+            int v[4], full[4];
+            for (c = 0; c < chans; c++) {
+                unsigned long bit = ((unsigned long)x * chans + c) * depth;
+                if (depth == 16) {
+                    full[c] = (row[bit / 8] << 8) | row[bit / 8 + 1];
+                    v[c] = row[bit / 8];
+                } else {
+                    v[c] = (row[bit / 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1);
+                    full[c] = v[c];
+                    if (ctype != 3) v[c] = v[c] * 255 / ((1 << depth) - 1);
+                }
+            }
+            switch (ctype) {
+            case 0:
+                o[0] = o[1] = o[2] = v[0];
+                o[3] = full[0] == trns_gray ? 0 : 255;
+                break;
+            case 2:
+                for (c = 0; c < 3; c++) o[c] = v[c];
+                o[3] = (full[0] == trns_rgb[0] && full[1] == trns_rgb[1] &&
+                        full[2] == trns_rgb[2]) ? 0 : 255;
+                break;
+            case 3:
+                for (c = 0; c < 3; c++) o[c] = plte[v[0]][c];
+                o[3] = trns[v[0]];
+                break;
+            case 4:
+                o[0] = o[1] = o[2] = v[0];
+                o[3] = v[1];
+                break;
+            case 6:
+                for (c = 0; c < 4; c++) o[c] = v[c];
+                break;
+            }
+        }
+    }
+    free(file);
+    free(idat);
+    free(raw);
+    *pw = w;
+    *ph = h;
+    return rgba;
+}
+
+// === palette ===========================================================
+#define MAXCOLORS 65536
+
+static unsigned short pal[MAXCOLORS];
+static unsigned long pal_count[MAXCOLORS];
+static int npal;
+
+static int dist565(unsigned short a, unsigned short b) {
+    int dr = ((a >> 11) - (b >> 11)) * 2, dg = ((a >> 5) & 63) - ((b >> 5) & 63);
+    int db = ((a & 31) - (b & 31)) * 2;
+    return dr * dr + dg * dg + db * db;
+}
+
+// the palette entry from first on closest to c
+static int nearest(unsigned short c, int first) {
+    int i, best = first;
+
+    for (i = first + 1; i < npal; i++)
+        if (dist565(c, pal[i]) < dist565(c, pal[best])) best = i;
+    return best;
+}
+
+// merge the closest pair of colors until max are left; the more
+// common color of a pair wins
+static void reduce(int max) {
+    int i, j, bi = 0, bj = 1, d, bd;
+
+    while (npal > max) {
+        bd = 1 << 30;
+        for (i = 0; i < npal; i++)
+            for (j = i + 1; j < npal; j++)
+                if ((d = dist565(pal[i], pal[j])) < bd) {
+                    bd = d;
+                    bi = i;
+                    bj = j;
+                }
+        if (pal_count[bj] > pal_count[bi]) pal[bi] = pal[bj];
+        pal_count[bi] += pal_count[bj];
+        pal[bj] = pal[--npal];
+        pal_count[bj] = pal_count[npal];
+    }
+}
+
+// === encoders ==========================================================
+static unsigned char *enc;
+static unsigned long nenc;
+
+static void emit(unsigned char c) { enc[nenc++] = c; }
+
+static void encode(const unsigned char *idx, int w, int h, int format) {
+    int x, y;
+    unsigned long i, n, total = (unsigned long)w * h;
+
+    nenc = 0;
+    if (format == TFT_BITMAP_1BPP) {
+        for (y = 0; y < h; y++)
+            for (x = 0; x < w; x += 8) {
+                unsigned char b = 0;
+                int k;
+                for (k = 0; k < 8 && x + k < w; k++)
+                    if (idx[y * w + x + k]) b |= 0x80 >> k;
+                emit(b);
+            }
+    } else if (format == TFT_BITMAP_4BPP) {
+        for (y = 0; y < h; y++)
+            for (x = 0; x < w; x += 2)
+                emit((idx[y * w + x] << 4) | (x + 1 < w ? idx[y * w + x + 1] : 0));
+    } else {
+        for (i = 0; i < total; i += n) {
+            for (n = 1; i + n < total && n < 271 && idx[i + n] == idx[i]; n++) ;
+            if (n < 16) emit((idx[i] << 4) | (n - 1));
+            else {
+                emit((idx[i] << 4) | 15);
+                emit(n - 16);
+            }
+        }
+    }
+}
+
+// === main ==============================================================
+int main(int argc, char **argv) {
+    static const char *names[] = { "TFT_BITMAP_1BPP", "TFT_BITMAP_4BPP",
+        "TFT_BITMAP_RLE" };
+    const char *in = NULL, *outpath = NULL, *name = "image";
+    int format = -1, key = -1, w, h, i, best, f, max;
+    unsigned long n, size[3];
+    unsigned char *rgba, *idx;
+    FILE *out = stdout;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-f") && i + 1 < argc) {
+            i++;
+            format = !strcmp(argv[i], "1") ? TFT_BITMAP_1BPP :
+                     !strcmp(argv[i], "4") ? TFT_BITMAP_4BPP :
+                     !strcmp(argv[i], "rle") ? TFT_BITMAP_RLE : -2;
+            if (format == -2) fail("-f takes 1, 4 or rle");
+        } else if (!strcmp(argv[i], "-n") && i + 1 < argc) name = argv[++i];
+        else if (!in) in = argv[i];
+        else if (!outpath) outpath = argv[i];
+        else in = NULL, i = argc;
+    }
+    if (!in) {
+        fprintf(stderr, "usage: png2bitmap [-f 1|4|rle] [-n name] image.png [image.c]\n");
+        return 2;
+    }
+
+    rgba = png_read(in, &w, &h);
+    n = (unsigned long)w * h;
+    idx = malloc(n);
+    enc = malloc(2 * n + 16);
+    if (!idx || !enc) fail("out of memory");
+
+    // colors in use, see-through pixels apart
+    for (i = 0; i < (long)n; i++) {
+        unsigned char *p = rgba + i * 4;
+        unsigned short c = ((p[0] >> 3) << 11) | ((p[1] >> 2) << 5) | (p[2] >> 3);
+        int k;
+        if (p[3] < 128) {
+            key = 0;
+            continue;
+        }
+        for (k = 0; k < npal && pal[k] != c; k++) ;
+        if (k == npal) pal[npal++] = c;
+        pal_count[k]++;
+    }
+    // the key takes index 0 of the palette
+    max = (format == TFT_BITMAP_1BPP ? 2 : 16) - (key == 0);
+    if (npal > max) {
+        fprintf(stderr, "png2bitmap: %d colors, merged to %d\n", npal, max);
+        reduce(max);
+    }
+    if (key == 0) {
+        memmove(pal + 1, pal, npal * sizeof(pal[0]));
+        npal++;
+    }
+    for (i = 0; i < (long)n; i++) {
+        unsigned char *p = rgba + i * 4;
+        unsigned short c = ((p[0] >> 3) << 11) | ((p[1] >> 2) << 5) | (p[2] >> 3);
+        // the key entry is no color to match
+        idx[i] = (p[3] < 128) ? 0 : nearest(c, key == 0);
+    }
+
+    // the smallest format the colors fit in
+    best = format;
+    for (f = 0; f < 3; f++) {
+        size[f] = 0;
+        if ((f == TFT_BITMAP_1BPP) && (npal > 2)) continue;
+        encode(idx, w, h, f);
+        size[f] = nenc;
+        if ((format < 0) && ((best < 0) || (size[f] < size[best]))) best = f;
+    }
+    encode(idx, w, h, best);
+
+    if (outpath && !(out = fopen(outpath, "w"))) fail("cannot write the C file");
+    fprintf(out, "// %s: %dx%d, %s, %d colors, %lu bytes\n", in, w, h,
+            names[best], npal, nenc);
+    fprintf(out, "// made by host/png2bitmap.c, do not edit\n\n");
+    fprintf(out, "#include \"tft_bitmap.h\"\n\n");
+    fprintf(out, "static const unsigned short %s_palette[%d] = {", name, npal);
+    for (i = 0; i < npal; i++)
+        fprintf(out, "%s0x%04x,", i % 8 ? " " : "\n    ", pal[i]);
+    fprintf(out, "\n};\n\n");
+    fprintf(out, "static const unsigned char %s_data[%lu] = {", name, nenc);
+    for (n = 0; n < nenc; n++)
+        fprintf(out, "%s0x%02x,", n % 12 ? " " : "\n    ", enc[n]);
+    fprintf(out, "\n};\n\n");
+    fprintf(out, "const struct tft_bitmap %s = {\n    %d, %d, %s, %d,\n"
+            "    %s_palette, %s_data\n};\n", name, w, h, names[best], key,
+            name, name);
+    if (out != stdout) fclose(out);
+    fprintf(stderr, "png2bitmap: %s %dx%d, %d colors:", in, w, h, npal);
+    for (f = 0; f < 3; f++)
+        if (size[f]) fprintf(stderr, " %s %lu", names[f] + 11, size[f]);
+    fprintf(stderr, " bytes, %s taken\n", names[best]);
+    return 0;
+}
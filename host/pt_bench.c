@@ -0,0 +1,619 @@
+/*
+ * File:   pt_bench.c
+ *
+ * Host benchmarks for the protothread scheduler in pt_cornell_1_3_2.h.
+ * No board needed: the header is compiled as is against host/plib.h,
+ * and a 1 ms interval timer calls its Timer1Handler(), so
+ * time_tick_millsec runs in real time.
+ *
+ * Build and run from the repo root:
+ *   gcc -O2 -fcommon -Wno-int-conversion -I. -Ihost -o pt_bench \
+ *       host/pt_bench.c
+ * (pt_add() returns NULL as an int when the thread list is full)
+ *   ./pt_bench             (all benchmarks)
+ *   ./pt_bench sleep       (just one)
+ *   ./pt_bench idle
+ *   ./pt_bench priority
+ *   ./pt_bench edf
+ * Add -Duse_thread_profile for the profiler, and the "profile" benchmark.
+ *
+ * Counts are per second of host time. They show what the scheduler
+ * costs relative to the threads, not PIC32 speed.
+ */
+
+#include <setjmp.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+#define sys_clock 40000000
+#define pb_clock sys_clock/1
+#define use_uart_serial
+#define BAUDRATE 38400
+#include "pt_cornell_1_3_2.h"
+
+// === stand-ins for what the header touches ===========================
+volatile unsigned int U2RXREG, U2TXREG, U2STA = 0x100, ANSELA, ANSELB;
+void OpenTimer1(unsigned int config, unsigned int period) { }
+void ConfigIntTimer1(unsigned int config) { }
+void SYSTEMConfig(unsigned int sys_clock_hz, unsigned int flags) { }
+void UARTConfigure(int uart, int flags) { }
+void UARTSetLineControl(int uart, int flags) { }
+void UARTSetDataRate(int uart, unsigned int pb_hz, unsigned int baud) { }
+void UARTEnable(int uart, int flags) { }
+void DmaChnOpen(int chn, int pri, int oflags) { }
+void DmaChnSetTxfer(int chn, const void *vSrcAdd, void *vDstAdd,
+                    int srcSize, int dstSize, int cellSize) { }
+void DmaChnSetEventControl(int chn, unsigned int flags) { }
+void DmaChnSetEvEnableFlags(int chn, unsigned int flags) { }
+void DmaChnSetMatchPattern(int chn, unsigned int pattern) { }
+void DmaChnDisable(int chn) { }
+void INTEnableSystemMultiVectoredInt(void) { }
+void INTSetVectorPriority(int vec, int pri) { }
+
+// interrupts off is SIGALRM blocked
+unsigned int INTDisableInterrupts(void) {
+    sigset_t alrm, old;
+    sigemptyset(&alrm);
+    sigaddset(&alrm, SIGALRM);
+    sigprocmask(SIG_BLOCK, &alrm, &old);
+    return !sigismember(&old, SIGALRM);
+}
+
+void INTRestoreInterrupts(unsigned int status) {
+    sigset_t alrm;
+    if (!status) return;
+    sigemptyset(&alrm);
+    sigaddset(&alrm, SIGALRM);
+    sigprocmask(SIG_UNBLOCK, &alrm, NULL);
+}
+
+// the MIPS wait: sleep until the next signal
+void sim_asm(const char *insn) {
+    if (!strcmp(insn, "wait")) pause();
+}
+
+// === a UART2 and DMA1 driven by the 1 ms tick ========================
+// A line of input is typed every RX_LINE_MS, a character a ms, and DMA
+// sends go out at about 4 characters a ms (38400 baud). The status reads
+// the threads poll are counted.
+#define RX_LINE_MS 100
+static const char rx_line[] = "led on\r";
+static volatile int rx_on, rx_pos = -1, rx_avail;
+static volatile unsigned char rx_char;
+static volatile int tx_left;
+static volatile unsigned int dma_flags;
+static volatile int int_enabled[16], int_flag[16];
+static unsigned long status_polls;
+
+static void int_raise(int src) {
+    int_flag[src] = 1;
+    if (!int_enabled[src]) return;
+    if (src == INT_U2RX) U2Handler();
+    if (src == INT_DMA1) DMA1Handler();
+}
+
+// a flag that went up while its interrupt was off fires on enable
+void INTEnable(int src, int enable) {
+    int_enabled[src] = enable;
+    if (enable && int_flag[src]) int_raise(src);
+}
+void INTClearFlag(int src) { int_flag[src] = 0; }
+
+int UARTReceivedDataIsAvailable(int uart) {
+    status_polls++;
+    return rx_avail;
+}
+int UARTTransmitterIsReady(int uart) { return 1; }
+unsigned char UARTGetDataByte(int uart) {
+    rx_avail = 0;
+    return rx_char;
+}
+void UARTSendDataByte(int uart, unsigned char c) { }
+
+void DmaChnEnable(int chn) { tx_left = strlen(PT_send_buffer) - 1; }
+void DmaChnClrEvFlags(int chn, unsigned int flags) { dma_flags &= ~flags; }
+unsigned int DmaChnGetEvFlags(int chn) {
+    status_polls++;
+    return dma_flags;
+}
+
+static void serial_tick(void) {
+    if (rx_on && rx_pos < 0 && time_tick_millsec % RX_LINE_MS == 0) rx_pos = 0;
+    if (rx_pos >= 0 && !rx_avail) {
+        rx_char = rx_line[rx_pos++];
+        rx_avail = 1;
+        if (rx_pos == sizeof(rx_line) - 1) rx_pos = -1;
+        int_raise(INT_U2RX);
+    }
+    if (tx_left > 0 && (tx_left -= 4) <= 0) {
+        dma_flags |= DMA_EV_BLOCK_DONE;
+        int_raise(INT_DMA1);
+    }
+}
+
+static void serial_reset(void) {
+    rx_pos = -1;
+    rx_avail = tx_left = 0;
+    dma_flags = 0;
+    memset((void *)int_enabled, 0, sizeof(int_enabled));
+    memset((void *)int_flag, 0, sizeof(int_flag));
+    status_polls = 0;
+}
+
+// the core timer counts at half the 40 MHz system clock, and only while
+// this program has the cpu: with wall time, whichever thread is running
+// when the host takes the cpu away gets the time billed to it
+unsigned int ReadCoreTimer(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (unsigned int)(ts.tv_sec * 20000000ull + ts.tv_nsec / 50);
+}
+
+// === an urgent event every URGENT_MS, raised from the tick ===========
+#define URGENT_MS 5
+static volatile int urgent_flag, urgent_thread = -1;
+static volatile unsigned int urgent_at;
+
+static void urgent_tick(void) {
+    if (time_tick_millsec % URGENT_MS || urgent_flag) return;
+    urgent_at = ReadCoreTimer();
+    urgent_flag = 1;
+    if (urgent_thread >= 0) PT_READY(urgent_thread);
+}
+
+static void tick_1ms(int sig) {
+    (void)sig;
+    Timer1Handler();
+    serial_tick();
+    urgent_tick();
+}
+
+// start the millisecond tick, as PT_setup() does on the board
+static void timer_start(void) {
+    struct itimerval it = { { 0, 1000 }, { 0, 1000 } };
+    signal(SIGALRM, tick_1ms);
+    setitimer(ITIMER_REAL, &it, NULL);
+}
+
+// run the scheduler until a thread calls sched_stop()
+static jmp_buf sched_done;
+
+static void sched_run(int method) {
+    pt_sched_method = method;
+    PT_INIT(&pt_sched);
+    if (!setjmp(sched_done)) PT_SCHEDULE(protothread_sched(&pt_sched));
+    // left from inside a thread: forget the scheduler state
+    pt_running = NULL;
+    pt_sleep_count = 0;
+    pt_task_count = 0;
+    pt_ready = 0;
+    pt_rx_thread = pt_tx_thread = -1;
+}
+
+static void sched_stop(void) {
+    longjmp(sched_done, 1);
+}
+
+// === sleeping threads: SECABB_sched_measure.c with timed threads ======
+// t1 yields as fast as it can, the others sleep in PT_YIELD_TIME_msec.
+// calls[] counts entries into each thread function, runs[] how often it
+// got past its yield
+static int count_thread1;
+static unsigned long calls[8], runs[8];
+
+static PT_THREAD (protothread_t1(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    while (1) {
+        PT_YIELD(pt);
+        count_thread1++;
+    }
+    PT_END(pt);
+}
+
+// one function per sleeper: PT_YIELD_TIME_msec keeps its time in a static
+#define SLEEPER(n, ms) \
+static PT_THREAD (protothread_sleep##n(struct pt *pt)) \
+{ \
+    calls[n]++; \
+    PT_BEGIN(pt); \
+    while (1) { \
+        PT_YIELD_TIME_msec(ms); \
+        runs[n]++; \
+    } \
+    PT_END(pt); \
+}
+SLEEPER(0, 2)
+SLEEPER(1, 4)
+SLEEPER(2, 10)
+SLEEPER(3, 50)
+SLEEPER(4, 100)
+SLEEPER(5, 1000)
+static const int sleep_ms[6] = { 2, 4, 10, 50, 100, 1000 };
+
+// the serial thread's 'c' command: count for 1000 ms, then stop
+static PT_THREAD (protothread_measure(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    count_thread1 = 0;
+    memset(calls, 0, sizeof(calls));
+    memset(runs, 0, sizeof(runs));
+    PT_YIELD_TIME_msec(1000);
+    sched_stop();
+    PT_END(pt);
+}
+
+static void bench_sleep(void) {
+    static const char *name[3] = { "SCHED_ROUND_ROBIN", "SCHED_RATE", "SCHED_SLEEP" };
+    static const int method[3] = { SCHED_ROUND_ROBIN, SCHED_RATE, SCHED_SLEEP };
+    unsigned long polls, woken, base = 0;
+    int m, i;
+
+    printf("sleep: t1 yielding, 6 threads in PT_YIELD_TIME_msec(2..1000), 1 s\n");
+    for (m = 0; m < 3; m++) {
+        pt_add(protothread_t1, 0);
+        pt_add(protothread_sleep0, 0);
+        pt_add(protothread_sleep1, 0);
+        pt_add(protothread_sleep2, 0);
+        pt_add(protothread_sleep3, 0);
+        pt_add(protothread_sleep4, 0);
+        pt_add(protothread_sleep5, 0);
+        pt_add(protothread_measure, 0);
+        sched_run(method[m]);
+
+        for (i = 0, polls = woken = 0; i < 6; i++) {
+            polls += calls[i];
+            woken += runs[i];
+        }
+        if (!m) base = count_thread1;
+        printf("  %-18s t1 %10d (%4.2fx)  sleeper calls %10lu, %6lu wake-ups, "
+               "1000 ms sleeper called %lu times\n",
+               name[m], count_thread1, base ? (double)count_thread1 / base : 0.0,
+               polls, woken, calls[5]);
+        for (i = 0; i < 6; i++)
+            if (runs[i] < 1000 / sleep_ms[i] - 1 || runs[i] > 1000 / sleep_ms[i] + 1)
+                printf("    %d ms sleeper ran %lu times\n", sleep_ms[i], runs[i]);
+    }
+}
+
+// === idle: serial command thread, a 10 ms blinker and nothing else ====
+// The serial thread waits for a line from the UART and answers it by
+// DMA, the way SECABB_sched_measure.c does; the blinker sleeps. Round
+// robin polls the UART and DMA status flat out, SCHED_SLEEP waits for
+// their interrupts and otherwise leaves the cpu in wait.
+static unsigned long lines, blinks;
+static int idle_percent;
+
+static PT_THREAD (protothread_serial(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    while (1) {
+        PT_SPAWN(pt, &pt_input, PT_GetSerialBuffer(&pt_input));
+        lines++;
+        sprintf(PT_send_buffer, "got %.50s\r\n", PT_term_buffer);
+        PT_SPAWN(pt, &pt_DMA_output, PT_DMA_PutSerialBuffer(&pt_DMA_output));
+    }
+    PT_END(pt);
+}
+
+static PT_THREAD (protothread_blink(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    while (1) {
+        PT_YIELD_TIME_msec(10);
+        blinks++;
+    }
+    PT_END(pt);
+}
+
+static PT_THREAD (protothread_idle_measure(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    PT_YIELD_TIME_msec(2000);
+    idle_percent = pt_idle_percent();
+    sched_stop();
+    PT_END(pt);
+}
+
+// === priority: an urgent event thread among busy ones ================
+// Two threads always have work (20 us per call); a third handles an
+// event raised every URGENT_MS. The time from the event to the thread
+// running is its latency. Worst cases include any time the host takes
+// the cpu away, milliseconds on a loaded machine.
+#define WORK_TICKS 400
+static unsigned long busy_calls, background_calls, urgent_runs;
+static unsigned int urgent_worst;
+static unsigned long long urgent_total;
+
+static void work(void) {
+    unsigned int t0 = ReadCoreTimer();
+    while (ReadCoreTimer() - t0 < WORK_TICKS) ;
+}
+
+static PT_THREAD (protothread_busy(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    while (1) {
+        work();
+        busy_calls++;
+        PT_YIELD(pt);
+    }
+    PT_END(pt);
+}
+
+static PT_THREAD (protothread_background(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    while (1) {
+        work();
+        background_calls++;
+        PT_YIELD(pt);
+    }
+    PT_END(pt);
+}
+
+static PT_THREAD (protothread_urgent(struct pt *pt))
+{
+    static unsigned int latency;
+    PT_BEGIN(pt);
+    while (1) {
+        urgent_thread = pt_self();
+        PT_YIELD_UNTIL_EVENT(pt, urgent_flag);
+        latency = ReadCoreTimer() - urgent_at;
+        urgent_flag = 0;
+        if (latency > urgent_worst) urgent_worst = latency;
+        urgent_total += latency;
+        urgent_runs++;
+    }
+    PT_END(pt);
+}
+
+static PT_THREAD (protothread_two_seconds(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    PT_YIELD_TIME_msec(2000);
+    sched_stop();
+    PT_END(pt);
+}
+
+static void bench_priority(void) {
+    static const struct {
+        const char *name;
+        int method, busy, background, urgent;
+    } run[3] = {
+        { "SCHED_RATE 0,3,2",     SCHED_RATE,     0, 3, 2 },
+        { "SCHED_RATE 0,3,0",     SCHED_RATE,     0, 3, 0 },
+        { "SCHED_PRIORITY 1,3,0", SCHED_PRIORITY, 1, 3, 0 },
+    };
+    int m, pri;
+
+    printf("priority: busy, background and urgent thread (event every %d ms), "
+           "%d us of work per busy call, 2 s\n", URGENT_MS, WORK_TICKS / 20);
+    for (m = 0; m < 3; m++) {
+        busy_calls = background_calls = urgent_runs = 0;
+        urgent_worst = 0;
+        urgent_total = 0;
+        urgent_flag = 0;
+        pt_add(protothread_busy, run[m].busy);
+        pt_add(protothread_background, run[m].background);
+        pt_add(protothread_urgent, run[m].urgent);
+        pt_add(protothread_two_seconds, 0);
+        sched_run(run[m].method);
+        urgent_thread = -1;
+
+        printf("  %-21s urgent %4lu runs, latency mean %5.1f us worst %5u us;"
+               "  busy %6lu, background %6lu calls\n",
+               run[m].name, urgent_runs,
+               urgent_runs ? urgent_total / 20.0 / urgent_runs : 0.0,
+               urgent_worst / 20, busy_calls, background_calls);
+        if (run[m].method != SCHED_PRIORITY) continue;
+        printf("    pt_latency_max:");
+        for (pri = 0; pri < PT_PRIORITIES; pri++)
+            if (pt_latency_max[pri])
+                printf(" priority %d %u us", pri, PT_TICKS_TO_USEC(pt_latency_max[pri]));
+        printf("\n");
+    }
+}
+
+// === edf: periodic control threads over a busy background ============
+// Jobs are made of 1 ms chunks with a PT_YIELD after each, as a thread
+// drawing a frame band by band would. A background thread runs 1 ms
+// chunks whenever it gets the cpu.
+static unsigned long background_ms;
+
+static void work_ms(void) {
+    unsigned int t0 = ReadCoreTimer();
+    while (ReadCoreTimer() - t0 < 20000) ;
+}
+
+// one function for all four: thread n does edf_job[n].chunks per job
+static const struct {
+    const char *name;
+    int period, deadline, chunks;
+} edf_job[4] = {
+    { "sample",    10,  3,  1 },
+    { "keypad",    30, 30,  2 },
+    { "animation", 32, 32, 12 },
+    { "adc",      100, 20,  5 },
+};
+static int edf_done[4];
+
+static PT_THREAD (protothread_job(struct pt *pt))
+{
+    int n = ((struct ptx *)pt)->num;
+    PT_BEGIN(pt);
+    while (1) {
+        for (edf_done[n] = 0; edf_done[n] < edf_job[n].chunks; edf_done[n]++) {
+            work_ms();
+            PT_YIELD(pt);
+        }
+        PT_YIELD_PERIOD(pt);
+    }
+    PT_END(pt);
+}
+
+static PT_THREAD (protothread_background_ms(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    while (1) {
+        work_ms();
+        background_ms++;
+        PT_YIELD(pt);
+    }
+    PT_END(pt);
+}
+
+static void bench_edf(void) {
+    static const char *name[3] = { "SCHED_ROUND_ROBIN", "SCHED_SLEEP", "SCHED_EDF" };
+    static const int method[3] = { SCHED_ROUND_ROBIN, SCHED_SLEEP, SCHED_EDF };
+    int m, i, bin;
+
+    printf("edf: 4 periodic threads (59%% of the cpu) over a busy background, 2 s\n");
+    for (m = 0; m < 3; m++) {
+        background_ms = 0;
+        for (i = 0; i < 4; i++)
+            if (pt_add_periodic(protothread_job, edf_job[i].period,
+                                edf_job[i].deadline) < 0) {
+                printf("  thread list full\n");
+                return;
+            }
+        pt_add(protothread_background_ms, 0);
+        pt_add(protothread_two_seconds, 0);
+        sched_run(method[m]);
+
+        printf("  %-18s background %4lu ms\n", name[m], background_ms);
+        for (i = 0; i < 4; i++) {
+            printf("    %-9s %3d/%-3d ms, %2d ms of work: %3u jobs, %3u missed",
+                   edf_job[i].name, edf_job[i].period, edf_job[i].deadline,
+                   edf_job[i].chunks,
+                   PT_GET_JOBS(i), PT_GET_MISSES(i));
+            if (PT_GET_MISSES(i)) {
+                printf(", late by ms");
+                for (bin = 0; bin < PT_TARDY_BINS; bin++) {
+                    if (!PT_GET_TARDY(i, bin)) continue;
+                    if (bin == 0) printf(" 1");
+                    else if (bin == PT_TARDY_BINS - 1) printf(" %d+", 1 << bin);
+                    else printf(" %d-%d", 1 << bin, (2 << bin) - 1);
+                    printf(":%u", PT_GET_TARDY(i, bin));
+                }
+            }
+            printf("\n");
+        }
+    }
+}
+
+#ifdef use_thread_profile
+// === profile: SECABB_sched_measure.c's threads with work in them ======
+// t1 yields flat out, t2 and t3 wake every 2 and 4 ms for 100 and 300 us
+// of work, and the serial thread waits for a line every 100 ms
+static PT_THREAD (protothread_t2_work(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    while (1) {
+        PT_YIELD_TIME_msec(2);
+        work(); work(); work(); work(); work();
+    }
+    PT_END(pt);
+}
+
+static PT_THREAD (protothread_t3_work(struct pt *pt))
+{
+    static int k;
+    PT_BEGIN(pt);
+    while (1) {
+        PT_YIELD_TIME_msec(4);
+        for (k = 0; k < 15; k++) work();
+    }
+    PT_END(pt);
+}
+
+static void bench_profile(void) {
+    static const char *name[2] = { "SCHED_ROUND_ROBIN", "SCHED_SLEEP" };
+    static const int method[2] = { SCHED_ROUND_ROBIN, SCHED_SLEEP };
+    static const char *thread[5] = { "t1", "t2", "t3", "serial", "stop" };
+    char row[80];
+    int m, i;
+
+    printf("profile: the 't' table after 2 s\n");
+    for (m = 0; m < 2; m++) {
+        serial_reset();
+        pt_add(protothread_t1, 0);
+        pt_add(protothread_t2_work, 0);
+        pt_add(protothread_t3_work, 0);
+        pt_add(protothread_serial, 0);
+        pt_add(protothread_two_seconds, 0);
+        pt_profile_reset();
+        rx_on = 1;
+        sched_run(method[m]);
+        rx_on = 0;
+        printf("  %s\n    %s", name[m], PT_PROFILE_HEADER);
+        for (i = 0; i < 5; i++) {
+            pt_profile_string(row, i);
+            printf("    %s (%s)\n", strtok(row, "\r"), thread[i]);
+        }
+    }
+}
+#endif
+
+static double cpu_seconds(clockid_t clk) {
+    struct timespec ts;
+    clock_gettime(clk, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void bench_idle(void) {
+    static const char *name[2] = { "SCHED_ROUND_ROBIN", "SCHED_SLEEP" };
+    static const int method[2] = { SCHED_ROUND_ROBIN, SCHED_SLEEP };
+    double cpu, wall;
+    int m;
+
+    printf("idle: serial line every %d ms answered by DMA, 10 ms blinker, 2 s\n",
+           RX_LINE_MS);
+    for (m = 0; m < 2; m++) {
+        serial_reset();
+        lines = blinks = 0;
+        idle_percent = 0;
+        pt_add(protothread_serial, 0);
+        pt_add(protothread_blink, 0);
+        pt_add(protothread_idle_measure, 0);
+        cpu = cpu_seconds(CLOCK_PROCESS_CPUTIME_ID);
+        wall = cpu_seconds(CLOCK_MONOTONIC);
+        rx_on = 1;
+        sched_run(method[m]);
+        rx_on = 0;
+        cpu = cpu_seconds(CLOCK_PROCESS_CPUTIME_ID) - cpu;
+        wall = cpu_seconds(CLOCK_MONOTONIC) - wall;
+        printf("  %-18s %3lu lines, %3lu blinks, %10lu status polls, "
+               "host cpu %4.0f ms of %4.0f",
+               name[m], lines, blinks, status_polls, 1000 * cpu, 1000 * wall);
+        if (method[m] == SCHED_SLEEP)
+            printf(", idle %d%% over %u waits", idle_percent, pt_waits);
+        printf("\n");
+    }
+}
+
+static const struct {
+    const char *name;
+    void (*fn)(void);
+} benches[] = {
+    { "sleep", bench_sleep },
+    { "idle", bench_idle },
+    { "priority", bench_priority },
+    { "edf", bench_edf },
+#ifdef use_thread_profile
+    { "profile", bench_profile },
+#endif
+};
+
+int main(int argc, char **argv) {
+    unsigned int i;
+
+    timer_start();
+    for (i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+        if (argc > 1 && strcmp(argv[1], benches[i].name)) continue;
+        benches[i].fn();
+    }
+    return 0;
+}
@@ -0,0 +1,386 @@
+/*
+ * File:   sim_pic32.c
+ *
+ * Cycle-counting stand-in for the PIC32MX250 port B, SPI1, DMA and core
+ * timer, just enough to run tft_master.c and tft_gfx.c on a PC.
+ *
+ * Time model (all in 40 MHz system clock cycles):
+ *  -- every register access, status poll or SPI write costs the cpu
+ *     a cycle or two; asm("nop") costs one.
+ *  -- SPI1 shifts one bit every (2*(SPI1BRG+1)) cycles.  The transmit
+ *     side is a FIFO of depth 1 (standard buffer) or 128 bits (ENHBUF)
+ *     in front of the shift register.  A write into a full FIFO is dropped and counted as an
+ *     overrun, just like the real part.
+ *  -- a DMA channel triggered from the SPI1 tx irq moves one cell each
+ *     time the FIFO has room, in the background, while the cpu clock
+ *     runs on.  Block-done interrupts are dispatched to DMAnHandler().
+ *
+ * Background activity is evaluated lazily: every entry into the
+ * simulator first applies the pending SET/CLR store, then runs the
+ * SPI/DMA model up to the current cpu time.
+ */
+
+#include "plib.h"
+
+struct sim_counters sim;
+void (*sim_spi1_hook)(unsigned int word, int bits, int dc, int cs);
+void (*sim_latb_hook)(unsigned int old, unsigned int now);
+
+volatile unsigned int LATB, TRISB, ANSELA, ANSELB, RPB11R;
+sim_latb_bits LATBbits;
+sim_trisb_bits TRISBbits;
+volatile unsigned int SPI1CON, SPI1BUF, SPI1BRG;
+
+// === pending SET/CLR/INV store ========================================
+static volatile unsigned int *pend_reg;
+static volatile unsigned int pend_val;
+static int pend_op;
+
+// === SPI1 transmit pipeline ===========================================
+// words that have been written but not yet finished shifting
+#define SIM_FIFO_MAX 32
+static struct {
+    sim_time_t start, end;
+} fifo[SIM_FIFO_MAX];
+static int fifo_head, fifo_count;
+static sim_time_t bus_end;      // when the last queued word finishes
+
+// === DMA ==============================================================
+#define SIM_DMA_CHANNELS 4
+static struct {
+    int enabled, autoen;
+    const unsigned char *src;
+    void *dst;
+    unsigned int ssiz, dsiz, csiz, sptr;
+    unsigned int evctl, ev_en, ev_flags;
+    int irq_on;
+    sim_time_t ready;           // earliest time of the next cell
+} dma[SIM_DMA_CHANNELS];
+
+static sim_time_t now;
+static sim_time_t core_base;
+static int in_isr;
+static sim_spistat_bits stat_bits;
+
+static void run_background(sim_time_t t);
+
+static void sim_enter(void) {
+    if (pend_reg) {
+        volatile unsigned int *reg = pend_reg;
+        unsigned int old = *reg;
+        pend_reg = NULL;
+        if (pend_op == SIM_OP_SET)      *reg = old | pend_val;
+        else if (pend_op == SIM_OP_CLR) *reg = old & ~pend_val;
+        else                            *reg = old ^ pend_val;
+        if (reg == &SPI1CON && ((old ^ *reg) & 0xc00)) sim.mode_flips++;
+        if (reg == &LATB && old != *reg && sim_latb_hook)
+            sim_latb_hook(old, *reg);
+        // changing CS, D/C or the word width mid-word corrupts the panel
+        if (now < bus_end) {
+            if ((reg == &LATB && ((old ^ *reg) & 3)) ||
+                (reg == &SPI1CON && ((old ^ *reg) & 0xc00)))
+                sim.hazards++;
+        }
+    }
+    if (!in_isr) run_background(now);
+}
+
+static void tick(unsigned int c) {
+    now += c;
+    sim.cycles += c;
+}
+
+sim_time_t sim_now(void) {
+    sim_enter();
+    return now;
+}
+
+volatile unsigned int *sim_reg_op(volatile unsigned int *reg, int op) {
+    sim_enter();
+    tick(1);
+    pend_reg = reg;
+    pend_op  = op;
+    pend_val = 0;
+    return &pend_val;
+}
+
+void sim_asm(const char *insn) {
+    (void)insn;
+    tick(1);
+}
+
+void sim_work(unsigned int cycles) {
+    sim_enter();
+    tick(cycles);
+    run_background(now);
+}
+
+void sim_idle(unsigned int cycles) {
+    sim_enter();
+    now += cycles;
+    sim.idle_cycles += cycles;
+    run_background(now);
+}
+
+void sim_reset(void) {
+    sim_enter();
+    memset(&sim, 0, sizeof(sim));
+}
+
+// --- SPI helpers ---------------------------------------------------------
+static int word_bits(void) {
+    if (SPI1CON & 0x800) return 32;
+    if (SPI1CON & 0x400) return 16;
+    return 8;
+}
+
+// ENHBUF gives a 128-bit FIFO, otherwise there is just SPIxTXB
+static int fifo_depth(void) {
+    if (SPI1CON & 0x10000) return 128 / word_bits();
+    return 1;
+}
+
+static unsigned int bit_cycles(void) {
+    return 2 * (SPI1BRG + 1);
+}
+
+// drop words that have finished shifting by time t
+static void retire(sim_time_t t) {
+    while (fifo_count && fifo[fifo_head].end <= t) {
+        fifo_head = (fifo_head + 1) % SIM_FIFO_MAX;
+        fifo_count--;
+    }
+}
+
+// number of words still waiting in the tx buffer (not in the shifter)
+static int queued(sim_time_t t) {
+    int i, n = 0;
+    for (i = 0; i < fifo_count; i++)
+        if (fifo[(fifo_head + i) % SIM_FIFO_MAX].start > t) n++;
+    return n;
+}
+
+// earliest time at or after t when the tx buffer has a free slot
+static sim_time_t space_at(sim_time_t t) {
+    int q = queued(t), depth = fifo_depth();
+    if (q < depth) return t;
+    // the oldest buffered word moves into the shifter at its start time
+    return fifo[(fifo_head + fifo_count - q + (q - depth)) % SIM_FIFO_MAX].start;
+}
+
+static void spi_push(unsigned int word, sim_time_t t) {
+    int bits = word_bits();
+    sim_time_t start, dur;
+    retire(t);
+    if (queued(t) >= fifo_depth() || fifo_count == SIM_FIFO_MAX) {
+        sim.overruns++;
+        return;
+    }
+    dur   = (sim_time_t)bits * bit_cycles();
+    start = bus_end > t ? bus_end : t;
+    if (bus_end && start > bus_end) {
+        sim.gaps++;
+        sim.gap_cycles += start - bus_end;
+    }
+    bus_end = start + dur;
+    fifo[(fifo_head + fifo_count) % SIM_FIFO_MAX].start = start;
+    fifo[(fifo_head + fifo_count) % SIM_FIFO_MAX].end   = bus_end;
+    fifo_count++;
+    sim.bus_cycles += dur;
+    if (bits == 8)       { sim.words8++;  word &= 0xff; }
+    else if (bits == 16) { sim.words16++; word &= 0xffff; }
+    else                   sim.words32++;
+    if (sim_spi1_hook)
+        sim_spi1_hook(word, bits, LATB & 1, (LATB >> 1) & 1);
+}
+
+// --- background: DMA channels feeding SPI1 ---------------------------------
+static void dma_block_done(int chn, sim_time_t t) {
+    static void (*const vec[SIM_DMA_CHANNELS])(void) = {
+        DMA0Handler, DMA1Handler, DMA2Handler, DMA3Handler
+    };
+    dma[chn].ev_flags |= DMA_EV_BLOCK_DONE;
+    dma[chn].sptr = 0;
+    if (!dma[chn].autoen) dma[chn].enabled = 0;
+    if ((dma[chn].ev_en & DMA_EV_BLOCK_DONE) && dma[chn].irq_on && vec[chn]) {
+        // run the handler at the interrupt time; it steals cpu cycles
+        sim_time_t fg = now, fgc = sim.cycles, spent;
+        now = t + 12;           // interrupt latency and context save
+        in_isr = 1;
+        vec[chn]();
+        sim_enter();
+        in_isr = 0;
+        spent = (now - t) + 12; // plus context restore
+        now = fg + spent;
+        sim.cycles = fgc;
+        sim.isr_cycles += spent;
+    }
+}
+
+static void run_background(sim_time_t t) {
+    int chn;
+    for (;;) {
+        // pick the channel with the earliest pending cell
+        sim_time_t best = 0;
+        int pick = -1;
+        for (chn = 0; chn < SIM_DMA_CHANNELS; chn++) {
+            sim_time_t te;
+            if (!dma[chn].enabled || dma[chn].dst != (void *)&SPI1BUF)
+                continue;
+            if (!(dma[chn].evctl & DMA_EV_START_IRQ_EN) ||
+                ((dma[chn].evctl >> 8) & 0xff) != _SPI1_TX_IRQ)
+                continue;
+            te = space_at(dma[chn].ready);
+            if (pick < 0 || te < best) { pick = chn; best = te; }
+        }
+        if (pick < 0 || best > t) break;
+        {
+            unsigned int word = 0, n;
+            const unsigned char *p = dma[pick].src +
+                (dma[pick].sptr % dma[pick].ssiz);
+            for (n = 0; n < dma[pick].csiz && n < 4; n++)
+                word |= (unsigned int)p[n] << (8 * n);
+            spi_push(word, best);
+            sim.dma_cells++;
+            dma[pick].sptr += dma[pick].csiz;
+            dma[pick].ready = best + 3;
+            dma[pick].ev_flags |= DMA_EV_CELL_DONE;
+            if (dma[pick].sptr >= (dma[pick].ssiz > dma[pick].dsiz ?
+                                   dma[pick].ssiz : dma[pick].dsiz))
+                dma_block_done(pick, best + 3);
+        }
+    }
+    retire(t);
+}
+
+// --- SPI1 register interface --------------------------------------------------
+void WriteSPI1(unsigned int data) {
+    sim_enter();
+    tick(1);
+    SPI1BUF = data;
+    spi_push(data, now);
+}
+
+int TxBufFullSPI1(void) {
+    sim_enter();
+    tick(2);
+    sim.polls++;
+    retire(now);
+    return queued(now) >= fifo_depth();
+}
+
+sim_spistat_bits *sim_spi1stat(void) {
+    int q;
+    sim_enter();
+    tick(2);
+    sim.polls++;
+    retire(now);
+    q = queued(now);
+    memset(&stat_bits, 0, sizeof(stat_bits));
+    stat_bits.SPITBF   = q >= fifo_depth();
+    stat_bits.SPITBE   = q == 0;
+    stat_bits.SPIRBE   = 1;
+    stat_bits.SRMT     = now >= bus_end;
+    stat_bits.SPIBUSY  = now < bus_end;
+    stat_bits.TXBUFELM = q;
+    return &stat_bits;
+}
+
+unsigned int sim_spi1stat_word(void) {
+    sim_spistat_bits *b = sim_spi1stat();
+    return (b->SPITBF << 1) | (b->SPITBE << 3) | (b->SPIRBE << 5) |
+           (b->SRMT << 7) | (b->SPIBUSY << 11) | (b->TXBUFELM << 16);
+}
+
+void SpiChnOpen(int chn, unsigned int flags, unsigned int srcClkDiv) {
+    sim_enter();
+    tick(10);
+    if (chn != 1) return;
+    SPI1CON = flags;
+    SPI1BRG = srcClkDiv / 2 - 1;
+}
+
+// --- DMA register interface ---------------------------------------------------
+void DmaChnOpen(int chn, int pri, int oflags) {
+    (void)pri;
+    sim_enter();
+    tick(10);
+    memset(&dma[chn], 0, sizeof(dma[chn]));
+    dma[chn].autoen = (oflags & DMA_OPEN_AUTO) != 0;
+}
+
+void DmaChnSetTxfer(int chn, const void *vSrcAdd, void *vDstAdd,
+                    int srcSize, int dstSize, int cellSize) {
+    sim_enter();
+    tick(10);
+    dma[chn].src  = (const unsigned char *)vSrcAdd;
+    dma[chn].dst  = vDstAdd;
+    dma[chn].ssiz = srcSize;
+    dma[chn].dsiz = dstSize;
+    dma[chn].csiz = cellSize;
+    dma[chn].sptr = 0;
+}
+
+void DmaChnSetEventControl(int chn, unsigned int flags) {
+    sim_enter();
+    tick(2);
+    dma[chn].evctl = flags;
+}
+
+void DmaChnSetEvEnableFlags(int chn, unsigned int flags) {
+    sim_enter();
+    tick(2);
+    dma[chn].ev_en |= flags;
+}
+
+void DmaChnClrEvFlags(int chn, unsigned int flags) {
+    sim_enter();
+    tick(2);
+    dma[chn].ev_flags &= ~flags;
+}
+
+unsigned int DmaChnGetEvFlags(int chn) {
+    sim_enter();
+    tick(2);
+    sim.polls++;
+    return dma[chn].ev_flags;
+}
+
+void DmaChnEnable(int chn) {
+    sim_enter();
+    tick(2);
+    dma[chn].enabled = 1;
+    dma[chn].ready = now;
+    if (!in_isr) run_background(now);
+}
+
+void DmaChnDisable(int chn) {
+    sim_enter();
+    tick(2);
+    dma[chn].enabled = 0;
+}
+
+// --- interrupt controller -----------------------------------------------------
+void INTEnable(int src, int enable) {
+    sim_enter();
+    tick(2);
+    if (src >= INT_DMA0 && src <= INT_DMA3) dma[src - INT_DMA0].irq_on = enable;
+}
+
+void INTClearFlag(int src)                  { (void)src; sim_enter(); tick(2); }
+void INTSetVectorPriority(int vec, int pri) { (void)vec; (void)pri; sim_enter(); tick(2); }
+void INTSetVectorSubPriority(int vec, int sub) { (void)vec; (void)sub; sim_enter(); tick(2); }
+void INTEnableSystemMultiVectoredInt(void)  { sim_enter(); tick(2); }
+
+// --- core timer: counts at half the system clock ------------------------------
+unsigned int ReadCoreTimer(void) {
+    sim_enter();
+    tick(2);
+    return (unsigned int)((now - core_base) / 2);
+}
+
+void WriteCoreTimer(unsigned int t) {
+    sim_enter();
+    tick(1);
+    core_base = now - (sim_time_t)t * 2;
+}
@@ -0,0 +1,1863 @@
+/*
+ * File:   tft_bench.c
+ *
+ * Host benchmarks for the TFT driver, run against the SPI1/DMA
+ * stand-in in sim_pic32.c.  No board needed.
+ *
+ * Build and run from the repo root:
+ *   gcc -O2 -fcommon -fgnu89-inline -I. -Ihost -o tft_bench \
+ *       host/tft_bench.c host/sim_pic32.c host/ili9340_emu.c \
+ *       tft_master.c tft_gfx.c tft_tile.c tft_console.c tft_sprite.c \
+ *       tft_scope.c tft_bitmap.c tft_font.c tft_font8.c tft_font16.c \
+ *       tft_font24aa.c tft_font32.c tft_field.c tft_band.c -lm
+ *   ./tft_bench            (all benchmarks)
+ *   ./tft_bench fill       (just one)
+ *
+ * Times are in 40 MHz system clock cycles unless marked otherwise.
+ * "cpu" is time the driver kept the cpu (spinning included), "isr" is
+ * time stolen by the DMA interrupt, "free" is time left over for other
+ * threads while the transfer was in flight.
+ */
+
+#include <math.h>
+#include "plib.h"
+#include "tft_master.h"
+#include "tft_gfx.h"
+#include "tft_tile.h"
+#include "tft_console.h"
+#include "tft_sprite.h"
+#include "tft_scope.h"
+#include "tft_bitmap.h"
+#include "tft_font.h"
+#include "tft_field.h"
+#include "tft_band.h"
+#include "ili9340_emu.h"
+#include "glcdfont.c"
+
+#define CYCLES_PER_US 40
+
+// snapshot of the simulator counters around a measured section
+struct bench_mark {
+    sim_time_t t;
+    struct sim_counters c;
+};
+
+static void mark(struct bench_mark *m) {
+    m->t = sim_now();
+    m->c = sim;
+}
+
+static void report(const char *name, struct bench_mark *m) {
+    sim_time_t el = sim_now() - m->t;
+    unsigned long words = (sim.words8 - m->c.words8) +
+        (sim.words16 - m->c.words16) + (sim.words32 - m->c.words32);
+    sim_time_t cpu = sim.cycles - m->c.cycles;
+    sim_time_t isr = sim.isr_cycles - m->c.isr_cycles;
+    sim_time_t idle = sim.idle_cycles - m->c.idle_cycles;
+    printf("  %-28s %9.1f us %8lu words  cpu %9llu  isr %7llu  free %9llu (%5.1f%%)",
+           name, (double)el / CYCLES_PER_US, words,
+           cpu, isr, idle, el ? 100.0 * idle / el : 0.0);
+    if (sim.overruns != m->c.overruns || sim.hazards != m->c.hazards)
+        printf("  overruns %lu hazards %lu", sim.overruns - m->c.overruns,
+               sim.hazards - m->c.hazards);
+    printf("\n");
+}
+
+// === full screen and small fills: cpu loop vs DMA =====================
+static void bench_fill(void) {
+    struct bench_mark m;
+    static const short sizes[][2] = { {240, 320}, {100, 100}, {20, 10} };
+    int i;
+    char name[40];
+
+    printf("fill: tft_fillRect loop vs tft_fillRectDMA\n");
+    for (i = 0; i < 3; i++) {
+        short w = sizes[i][0], h = sizes[i][1];
+
+        sprintf(name, "fillRect %dx%d", w, h);
+        mark(&m);
+        tft_fillRect(0, 0, w, h, ILI9340_BLUE);
+        report(name, &m);
+
+        // the waiting thread yields, other threads get the cpu meanwhile
+        sprintf(name, "fillRectDMA %dx%d", w, h);
+        mark(&m);
+        tft_fillRectDMA(0, 0, w, h, ILI9340_RED);
+        while (tft_dmaBusy()) sim_idle(100);
+        report(name, &m);
+    }
+}
+
+// === dashboard scene: text rows, bars and gauges built from spans =====
+static void scene_dashboard(void) {
+    short i, y;
+    char line[40];
+
+    for (i = 0; i < 6; i++) {
+        // printLine(): erase the row, then the text
+        tft_fillRoundRect(0, i * 10, 239, 8, 1, ILI9340_BLACK);
+        tft_setCursor(0, i * 10);
+        tft_setTextColor(ILI9340_YELLOW);
+        tft_setTextSize(1);
+        sprintf(line, "channel %d = %04d mV", i, 1234 + 111 * i);
+        tft_writeString(line);
+    }
+    // horizontal bar graph drawn one scanline at a time
+    for (i = 0; i < 8; i++)
+        for (y = 0; y < 10; y++)
+            tft_drawFastHLine(10, 80 + i * 14 + y, 20 + 25 * i, ILI9340_GREEN);
+    tft_fillTriangle(20, 300, 120, 200, 220, 300, ILI9340_CYAN);
+    tft_fillCircle(180, 110, 30, ILI9340_RED);
+    tft_fillRoundRect(10, 200, 80, 30, 6, ILI9340_BLUE);
+}
+
+static void bench_window(void) {
+    struct bench_mark m;
+    unsigned long sent = tft_win_sent, elided = tft_win_elided;
+
+    printf("window: address window cache on the dashboard scene\n");
+    mark(&m);
+    scene_dashboard();
+    report("dashboard", &m);
+    sent = tft_win_sent - sent;
+    elided = tft_win_elided - elided;
+    printf("  window command bytes: sent %lu, elided %lu (%.1f%% cut)\n",
+           sent, elided, 100.0 * elided / (sent + elided));
+}
+
+// === scatter plot: random points through tft_drawPixel ================
+static void bench_pixel(void) {
+    struct bench_mark m;
+    sim_time_t el;
+    int i;
+
+    printf("pixel: random-point plotting with tft_drawPixel\n");
+    srand(1);
+    mark(&m);
+    for (i = 0; i < 10000; i++)
+        tft_drawPixel(rand() % 240, rand() % 320, rand());
+    el = sim_now() - m.t;
+    report("10000 random pixels", &m);
+    printf("  %.0f pixels/s\n", 10000.0 * 40e6 / el);
+}
+
+static unsigned long bus_bytes(void) {
+    return sim.words8 + 2 * sim.words16 + 4 * sim.words32;
+}
+
+// === tiles: erase-then-draw animation, immediate vs off-screen tiles ==
+// one frame of protothread_anim plus a printLine2 status row, placed on
+// a tile row boundary
+static void scene_anim_frame(int f) {
+    short x0 = 10 + 4 * f, y0 = 40 + f * f / 4;
+    short x1 = x0 + 4, y1 = 40 + (f + 1) * (f + 1) / 4;
+    char line[20];
+
+    tft_fillCircle(x0, y0, 4, ILI9340_BLACK);
+    tft_fillCircle(x1, y1, 4, ILI9340_GREEN);
+    tft_fillRoundRect(0, 16, 239, 16, 1, ILI9340_BLACK);
+    tft_setTextColor(ILI9340_YELLOW);
+    tft_setCursor(0, 16);
+    tft_setTextSize(2);
+    sprintf(line, "frame %d", f);
+    tft_writeString(line);
+}
+
+static void bench_tile(void) {
+    static unsigned short direct[EMU_HEIGHT][EMU_WIDTH];
+    struct bench_mark m;
+    unsigned long b0, direct_bytes;
+    int f, frames = 30;
+
+    printf("tile: %d animation frames, immediate vs off-screen tiles\n", frames);
+    tft_fillScreen(ILI9340_BLACK);
+    b0 = bus_bytes();
+    mark(&m);
+    for (f = 0; f < frames; f++) scene_anim_frame(f);
+    report("immediate", &m);
+    direct_bytes = bus_bytes() - b0;
+    memcpy(direct, emu_frame, sizeof(direct));
+
+    tft_fillScreen(ILI9340_BLACK);
+    tft_tile_bytes = tft_tile_direct_bytes = tft_tile_evictions = 0;
+    b0 = bus_bytes();
+    mark(&m);
+    for (f = 0; f < frames; f++) {
+        tft_tileBegin(ILI9340_BLACK);
+        scene_anim_frame(f);
+        tft_tileEnd();
+    }
+    report("tiled", &m);
+    printf("  bytes/frame: immediate %lu, tiled %lu (tile counters: %lu sent, "
+           "%lu direct estimate, %lu evictions)\n",
+           direct_bytes / frames, (bus_bytes() - b0) / frames,
+           tft_tile_bytes / frames, tft_tile_direct_bytes / frames,
+           tft_tile_evictions);
+    printf("  frames %s\n", memcmp(direct, emu_frame, sizeof(direct)) ?
+           "DIFFER" : "identical");
+    emu_write_ppm("tile_frame.ppm");
+    printf("  wrote tile_frame.ppm\n");
+
+    // evict-then-revisit: a pixel in cell (0,0), one pixel in each of the
+    // next TFT_TILE_POOL cells down column 0 to push (0,0) out early, then
+    // more drawing in (0,0) that must not paint over the first pixel
+    tft_fillScreen(ILI9340_BLACK);
+    tft_tile_evictions = 0;
+    tft_tileBegin(ILI9340_BLACK);
+    tft_drawPixel(5, 5, ILI9340_RED);
+    for (f = 1; f <= TFT_TILE_POOL; f++)
+        tft_drawPixel(0, f * TFT_TILE_HEIGHT, ILI9340_BLUE);
+    tft_fillRect(2, 2, 2, 2, ILI9340_GREEN);   // dirty rect spans (5,5)
+    tft_fillRect(20, 10, 2, 2, ILI9340_GREEN);
+    tft_tileEnd();
+    printf("  evict-then-revisit (%lu evictions): %s\n", tft_tile_evictions,
+           emu_frame[5][5] == ILI9340_RED && emu_frame[2][2] ==
+           ILI9340_GREEN && emu_frame[11][21] == ILI9340_GREEN &&
+           emu_frame[6][5] == ILI9340_BLACK ? "ok" : "FAIL");
+}
+
+// === text: per-cell glyphs vs one window per glyph ====================
+// a status screen of printLine()-style rows at sizes 1 and 2
+static void scene_text(void (*draw)(short, short, unsigned char,
+                                    unsigned short, unsigned short,
+                                    unsigned char), unsigned short bg) {
+    static const char msg[] = "ADC1 = 0512  ADC2 = 1023";
+    short row, i;
+
+    for (row = 0; row < 12; row++) {
+        unsigned char size = (row & 1) + 1;
+        for (i = 0; msg[i] && i * 6 * size < 240; i++)
+            draw(i * 6 * size, row * 20, msg[i], ILI9340_YELLOW, bg, size);
+    }
+}
+
+static void bench_text(void) {
+    static unsigned short cells[EMU_HEIGHT][EMU_WIDTH];
+    static const struct { const char *name; unsigned short bg; } modes[] = {
+        { "opaque", ILI9340_BLUE }, { "transparent", ILI9340_YELLOW },
+    };
+    struct bench_mark m;
+    sim_time_t t_cells, t_glyph;
+    char name[40];
+    int i;
+
+    printf("text: tft_drawChar per cell vs one window per glyph\n");
+    for (i = 0; i < 2; i++) {
+        tft_fillScreen(ILI9340_BLACK);
+        sprintf(name, "%s, per cell", modes[i].name);
+        mark(&m);
+        scene_text(tft_drawCharCells, modes[i].bg);
+        t_cells = sim_now() - m.t;
+        report(name, &m);
+        memcpy(cells, emu_frame, sizeof(cells));
+
+        tft_fillScreen(ILI9340_BLACK);
+        sprintf(name, "%s, per glyph", modes[i].name);
+        mark(&m);
+        scene_text(tft_drawChar, modes[i].bg);
+        t_glyph = sim_now() - m.t;
+        report(name, &m);
+        printf("  speedup %.1fx, frames %s\n", (double)t_cells / t_glyph,
+               memcmp(cells, emu_frame, sizeof(cells)) ? "DIFFER" : "identical");
+    }
+}
+
+// === string: printLine2() from TFT_ADC_read_SCAN.c in each text mode ==
+// 10 s of the demo: the ADC line every 100 ms, the seconds line every 1 s
+static void printLine2(int line_number, char *print_buffer,
+                       short text_color, short back_color, char opaque) {
+    int v_pos = line_number * 20;
+    short w = 12 * strlen(print_buffer);
+
+    if (opaque) {
+        // text on its own background, erase only what is right of it
+        tft_fillRect(w, v_pos, 239 - w, 16, back_color);
+        tft_setTextColor2(text_color, back_color);
+    } else {
+        tft_fillRoundRect(0, v_pos, 239, 16, 1, back_color);
+        tft_setTextColor(text_color);
+    }
+    tft_setCursor(0, v_pos);
+    tft_setTextSize(2);
+    tft_writeString(print_buffer);
+}
+
+static void scene_scan(char opaque) {
+    char buffer[60];
+    int i;
+
+    for (i = 0; i < 100; i++) {
+        if (i % 10 == 0) {
+            sprintf(buffer, "%d", i / 10);
+            printLine2(1, buffer, ILI9340_YELLOW, ILI9340_BLACK, opaque);
+        }
+        sprintf(buffer, "AN11=%04d AN5=%04d ", (i * 37) & 1023, (i * 91) & 1023);
+        printLine2(5, buffer, ILI9340_YELLOW, ILI9340_BLACK, opaque);
+    }
+}
+
+static void bench_string(void) {
+    static unsigned short first[EMU_HEIGHT][EMU_WIDTH];
+    static const struct {
+        const char *name;
+        unsigned char mode;
+        char opaque;
+    } modes[] = {
+        { "tft_write loop (cells)", TEXT_CELL, 0 },
+        { "per-glyph window", TEXT_GLYPH, 0 },
+        { "whole string", TEXT_STRING, 0 },
+        { "whole string, opaque", TEXT_STRING, 1 },
+    };
+    struct bench_mark m;
+    sim_time_t t0 = 0, t;
+    int i;
+
+    // the opaque run can differ from the others in a pixel: the rounded
+    // erase there leaves the top-left corner of the last glyph behind
+    printf("string: printLine2 workload, 110 lines per run\n");
+    for (i = 0; i < 4; i++) {
+        tft_fillScreen(ILI9340_BLACK);
+        tft_setTextMode(modes[i].mode);
+        mark(&m);
+        scene_scan(modes[i].opaque);
+        t = sim_now() - m.t;
+        report(modes[i].name, &m);
+        if (i == 0) {
+            t0 = t;
+            memcpy(first, emu_frame, sizeof(first));
+        } else {
+            int x, y, diff = 0;
+            for (y = 0; y < EMU_HEIGHT; y++)
+                for (x = 0; x < EMU_WIDTH; x++)
+                    if (first[y][x] != emu_frame[y][x]) diff++;
+            printf("  speedup %.1fx, %d pixels differ\n", (double)t0 / t, diff);
+        }
+    }
+    tft_setTextMode(TEXT_STRING);
+}
+
+// === field: the same workload through text fields ====================
+static void bench_field(void) {
+    static unsigned short ref[EMU_HEIGHT][EMU_WIDTH];
+    static struct tft_field time_field, adc_field;
+    struct bench_mark m;
+    sim_time_t t0, t;
+    unsigned long b, b0;
+    char buffer[60];
+    int i, x, y, diff = 0;
+
+    printf("field: printLine2 workload, only changed cells redrawn\n");
+    tft_setTextMode(TEXT_STRING);
+    tft_fillScreen(ILI9340_BLACK);
+    b = bus_bytes();
+    mark(&m);
+    scene_scan(1);
+    t0 = sim_now() - m.t;
+    b0 = bus_bytes() - b;
+    report("printLine2, opaque string", &m);
+    memcpy(ref, emu_frame, sizeof(ref));
+
+    tft_fillScreen(ILI9340_BLACK);
+    tft_fieldInit(&time_field, 0, 20, 19, 2);
+    tft_fieldInit(&adc_field, 0, 100, 19, 2);
+    tft_field_glyphs = tft_field_kept = 0;
+    b = bus_bytes();
+    mark(&m);
+    for (i = 0; i < 100; i++) {
+        if (i % 10 == 0)
+            tft_fieldPrintf(&time_field, ILI9340_YELLOW, ILI9340_BLACK, "%d", i / 10);
+        sprintf(buffer, "AN11=%04d AN5=%04d ", (i * 37) & 1023, (i * 91) & 1023);
+        tft_fieldPrint(&adc_field, buffer, ILI9340_YELLOW, ILI9340_BLACK);
+    }
+    t = sim_now() - m.t;
+    report("tft_fieldPrint", &m);
+    for (y = 0; y < EMU_HEIGHT; y++)
+        for (x = 0; x < EMU_WIDTH; x++)
+            if (ref[y][x] != emu_frame[y][x]) diff++;
+    printf("  %lu -> %lu bytes, speedup %.1fx, %lu glyphs drawn, %lu kept, "
+           "%d pixels differ\n", b0, bus_bytes() - b, (double)t0 / t,
+           tft_field_glyphs, tft_field_kept, diff);
+
+    // a 1 Hz seconds counter alone: the common case
+    tft_fieldInvalidate(&time_field);
+    tft_field_glyphs = 0;
+    b = bus_bytes();
+    for (i = 0; i < 1000; i++)
+        tft_fieldPrintf(&time_field, ILI9340_YELLOW, ILI9340_BLACK, "Time=%d", i);
+    printf("  seconds counter 0..999: %.2f glyphs, %lu bytes per update\n",
+           tft_field_glyphs / 1000.0, (bus_bytes() - b) / 1000);
+}
+
+// === console: hardware scrolling vs repainting every line =============
+// serial output as TFT_ADC_read_SCAN.c sends it: VT100 color and cursor
+// escapes, CR LF line ends, and now and then a line long enough to wrap
+static void console_line(char *buf, int i) {
+    if (i % 25 == 7)
+        sprintf(buf, "\x1b[33mwarning %d: the quick brown fox jumps over the lazy dog\r\n", i);
+    else
+        sprintf(buf, "\x1b[32mAN11=%04d AN5=%04d\x1b[K\r\n", (i * 37) & 1023, (i * 91) & 1023);
+}
+
+// reference console: text of the visible lines, kept the simple way
+#define REF_COLS 40
+#define REF_ROWS 38
+static char ref_text[REF_ROWS][REF_COLS + 1];
+static int ref_line, ref_col, ref_esc;
+
+static void ref_newline(void) {
+    ref_col = 0;
+    if (++ref_line >= REF_ROWS) {
+        memmove(ref_text[0], ref_text[1], sizeof(ref_text[0]) * (REF_ROWS - 1));
+        ref_line = REF_ROWS - 1;
+    }
+    memset(ref_text[ref_line], 0, sizeof(ref_text[0]));
+}
+
+static void ref_puts(const char *s) {
+    for (; *s; s++) {
+        if (ref_esc) {
+            if (ref_esc == 1 && *s == '[') ref_esc = 2;
+            else if (ref_esc == 1 || (*s >= '@' && *s <= '~')) ref_esc = 0;
+        } else if (*s == 0x1b) ref_esc = 1;
+        else if (*s == '\n') ref_newline();
+        else if (*s == '\r') ref_col = 0;
+        else {
+            if (ref_col >= REF_COLS) ref_newline();
+            ref_text[ref_line][ref_col++] = *s;
+        }
+    }
+}
+
+// what printLine() does to show a log: repaint every visible line
+static void ref_repaint(void) {
+    int row;
+    for (row = 0; row <= ref_line; row++) {
+        tft_fillRoundRect(0, 16 + row * 8, 239, 8, 1, ILI9340_BLACK);
+        tft_setTextColor(ILI9340_GREEN);
+        tft_setCursor(0, 16 + row * 8);
+        tft_setTextSize(1);
+        tft_writeString(ref_text[row]);
+    }
+}
+
+static void bench_console(void) {
+    static unsigned short shown[EMU_HEIGHT][EMU_WIDTH];
+    char buf[100];
+    struct bench_mark m;
+    unsigned long b0, scroll_bytes, repaint_bytes;
+    int i, lines = 200, repaints = 20;
+
+    printf("console: %d log lines under a 16-row fixed header\n", lines);
+    tft_fillScreen(ILI9340_BLACK);
+    tft_setTextColor(ILI9340_WHITE);
+    tft_setTextSize(2);
+    tft_setCursor(0, 0);
+    tft_writeString("serial log");
+    tft_consoleBegin(16, 0, 1, ILI9340_GREEN, ILI9340_BLACK);
+    memset(ref_text, 0, sizeof(ref_text));
+    ref_line = ref_col = ref_esc = 0;
+
+    // a viewport left pushed must not move or cut the console
+    tft_viewportPush(120, 100, 50, 50);
+    b0 = bus_bytes();
+    mark(&m);
+    for (i = 0; i < lines; i++) {
+        console_line(buf, i);
+        tft_consolePuts(buf);
+        ref_puts(buf);
+    }
+    report("hardware scroll", &m);
+    tft_clipPop();
+    scroll_bytes = (bus_bytes() - b0) / tft_console_lines;
+    emu_screen(shown);
+    emu_write_ppm("console.ppm");
+    printf("  scroll area starts at GRAM row %d\n", emu_vsp);
+
+    // the same text drawn unscrolled, repainted line by line
+    tft_consoleEnd();
+    tft_fillRect(0, 16, 240, 304, ILI9340_BLACK);
+    b0 = bus_bytes();
+    mark(&m);
+    for (i = 0; i < repaints; i++) ref_repaint();
+    report("repaint per new line", &m);
+    repaint_bytes = (bus_bytes() - b0) / repaints;
+
+    printf("  bytes per new line: scroll %lu, repaint %lu; screen %s the reference\n",
+           scroll_bytes, repaint_bytes,
+           memcmp(shown, emu_frame, sizeof(shown)) ? "DIFFERS from" : "matches");
+    printf("  wrote console.ppm\n");
+}
+
+// === width: bus idle gaps per primitive at this TFT_SPI_WIDTH ==========
+static unsigned short width_colors[9] = {
+    ILI9340_RED, ILI9340_GREEN, ILI9340_BLUE, ILI9340_CYAN, ILI9340_MAGENTA,
+    ILI9340_YELLOW, ILI9340_WHITE, ILI9340_BLACK, ILI9340_RED
+};
+
+static void width_pixel(int i)  { tft_drawPixel(i % 200, i % 300, i); }
+static void width_hline(int i)  { tft_drawFastHLine(i % 200, i % 300, 21, i); }
+static void width_rect(int i)   { tft_fillRect(i % 200, i % 300, 9, 9, i); }
+static void width_rect8(int i)  { tft_fillRect(i % 200, i % 300, 8, 8, i); }
+static void width_push(int i) {
+    tft_setAddrWindow(i % 200, i % 300, i % 200 + 2, i % 300 + 2);
+    tft_pushColors(width_colors, 9);
+}
+static void width_char(int i) {
+    tft_drawChar(i % 200, i % 300, 'A' + i % 26, ILI9340_WHITE, ILI9340_BLUE, 1);
+}
+static void width_cmd(int i)    { (void)i; tft_writecommand(ILI9340_NOP); }
+
+static void bench_width(void) {
+    static const struct {
+        const char *name;
+        void (*fn)(int);
+    } prims[] = {
+        { "drawPixel", width_pixel },
+        { "drawFastHLine 21", width_hline },
+        { "fillRect 9x9", width_rect },
+        { "fillRect 8x8", width_rect8 },
+        { "pushColors 3x3", width_push },
+        { "drawChar", width_char },
+        { "writecommand", width_cmd },
+    };
+    int p, i, n = 1000;
+
+    printf("width: TFT_SPI_WIDTH %d, %d calls per primitive\n", TFT_SPI_WIDTH, n);
+    printf("  %-18s %9s %9s %8s %12s %10s %8s\n", "per call:", "us", "bus us",
+           "gaps", "gap cycles", "mode flips", "words");
+    for (p = 0; p < (int)(sizeof(prims) / sizeof(prims[0])); p++) {
+        struct bench_mark m;
+        sim_time_t el;
+        mark(&m);
+        for (i = 0; i < n; i++) prims[p].fn(i);
+        tft_writecommand(ILI9340_NOP);  // closes an open pixel stream
+        el = sim_now() - m.t;
+        printf("  %-18s %9.2f %9.2f %8.2f %12.1f %10.2f %8.2f\n", prims[p].name,
+               (double)el / CYCLES_PER_US / n,
+               (double)(sim.bus_cycles - m.c.bus_cycles) / CYCLES_PER_US / n,
+               (double)(sim.gaps - m.c.gaps) / n,
+               (double)(sim.gap_cycles - m.c.gap_cycles) / n,
+               (double)(sim.mode_flips - m.c.mode_flips) / n,
+               (double)((sim.words8 - m.c.words8) + (sim.words16 -
+                   m.c.words16) + (sim.words32 - m.c.words32)) / n);
+        if (sim.overruns != m.c.overruns || sim.hazards != m.c.hazards)
+            printf("  overruns %lu hazards %lu\n", sim.overruns - m.c.overruns,
+                   sim.hazards - m.c.hazards);
+    }
+}
+
+// === begin: startup to first frame, command lists ======================
+// static dashboard background: panels and a frame around the plot area
+static const unsigned char dash_list[] = {
+    7 * 3,
+    TFT_LIST_RECT(0, 0, 240, 320, ILI9340_BLACK),
+    TFT_LIST_RECT(0, 0, 240, 24, ILI9340_BLUE),
+    TFT_LIST_RECT(4, 32, 232, 120, 0x18E3),
+    TFT_LIST_RECT(4, 160, 112, 70, 0x2104),
+    TFT_LIST_RECT(124, 160, 112, 70, 0x2104),
+    TFT_LIST_RECT(4, 238, 232, 2, ILI9340_WHITE),
+    TFT_LIST_RECT(0, 300, 240, 20, ILI9340_BLUE),
+};
+
+static void dash_direct(void) {
+    tft_fillRect(0, 0, 240, 320, ILI9340_BLACK);
+    tft_fillRect(0, 0, 240, 24, ILI9340_BLUE);
+    tft_fillRect(4, 32, 232, 120, 0x18E3);
+    tft_fillRect(4, 160, 112, 70, 0x2104);
+    tft_fillRect(124, 160, 112, 70, 0x2104);
+    tft_fillRect(4, 238, 232, 2, ILI9340_WHITE);
+    tft_fillRect(0, 300, 240, 20, ILI9340_BLUE);
+}
+
+static void bench_begin(void) {
+    static unsigned short ref[EMU_HEIGHT][EMU_WIDTH];
+    struct bench_mark m;
+    struct tft_list l;
+    sim_time_t t_begin;
+
+    printf("begin: startup time model and display lists\n");
+    mark(&m);
+    tft_begin();
+    t_begin = sim_now() - m.t;
+    report("tft_begin", &m);
+    printf("  %.1f ms, %.1f us of it on the bus, the rest is the reset and "
+           "sleep-out delays\n", (double)t_begin / CYCLES_PER_US / 1000,
+           (double)(sim.bus_cycles - m.c.bus_cycles) / CYCLES_PER_US);
+
+    mark(&m);
+    dash_direct();
+    report("first frame, fillRect calls", &m);
+    memcpy(ref, emu_frame, sizeof(ref));
+
+    tft_fillScreen(ILI9340_RED);
+    mark(&m);
+    tft_commandList(dash_list);
+    report("first frame, tft_commandList", &m);
+    printf("  frame %s\n", memcmp(ref, emu_frame, sizeof(ref)) ? "DIFFERS" : "identical");
+
+    // a thread replaying the list: PT_TFT_LIST, everything else idles
+    tft_fillScreen(ILI9340_RED);
+    mark(&m);
+    tft_listStart(&l, dash_list);
+    while (tft_dmaBusy() || tft_listStep(&l)) sim_idle(100);
+    report("first frame, DMA list replay", &m);
+    printf("  frame %s, startup to first frame %.1f ms\n",
+           memcmp(ref, emu_frame, sizeof(ref)) ? "DIFFERS" : "identical",
+           (double)(t_begin + sim_now() - m.t) / CYCLES_PER_US / 1000);
+}
+
+// === rotate: the emulator against the four MADCTL settings ============
+// the same asymmetric scene in the top left 240x240 of every rotation
+static void scene_rotate(void) {
+    tft_fillScreen(ILI9340_BLACK);
+    tft_fillRect(0, 0, 60, 20, ILI9340_RED);
+    tft_drawFastVLine(5, 30, 100, ILI9340_GREEN);
+    tft_fillTriangle(100, 20, 230, 60, 120, 200, ILI9340_CYAN);
+    tft_drawChar(20, 150, 'F', ILI9340_YELLOW, ILI9340_BLUE, 6);
+    tft_drawPixel(239, 239, ILI9340_WHITE);
+}
+
+static void bench_rotate(void) {
+    static unsigned short ref[EMU_HEIGHT][EMU_WIDTH];
+    struct bench_mark m;
+    char name[40];
+    int r, x, y, diff;
+
+    printf("rotate: MADCTL in the panel emulator, pixel-exact check\n");
+    for (r = 0; r < 4; r++) {
+        tft_setRotation(r);
+        emu_reset_stats();
+        sprintf(name, "scene, rotation %d", r);
+        mark(&m);
+        scene_rotate();
+        report(name, &m);
+        printf("  emu: %lu bytes, words %lu/%lu/%lu (8/16/32), %lu mode "
+               "switches, %lu CS and %lu D/C toggles\n", emu.bytes,
+               emu.words8, emu.words16, emu.words32, emu.mode_switches,
+               emu.cs_toggles, emu.dc_toggles);
+        if (r == 0) memcpy(ref, emu_frame, sizeof(ref));
+        // logical (x, y) of rotation r on the glass, turned 90 degrees
+        // clockwise per step
+        diff = 0;
+        for (y = 0; y < 240; y++)
+            for (x = 0; x < 240; x++) {
+                unsigned short c =
+                    r == 0 ? emu_frame[y][x] :
+                    r == 1 ? emu_frame[x][239 - y] :
+                    r == 2 ? emu_frame[319 - y][239 - x] :
+                             emu_frame[319 - x][y];
+                if (c != ref[y][x]) diff++;
+            }
+        printf("  %s\n", diff ? "rotated frame DIFFERS" : "rotated frame matches rotation 0");
+        sprintf(name, "rotate%d.png", r);
+        emu_write_png(name);
+    }
+    tft_setRotation(0);
+}
+
+// === circle: span table fills vs the column-pair helper ===============
+static void old_fillCircle(short x0, short y0, short r, unsigned short c) {
+    tft_drawFastVLine(x0, y0 - r, 2 * r + 1, c);
+    tft_fillCircleHelper(x0, y0, r, 3, 0, c);
+}
+
+static void old_fillRoundRect(short x, short y, short w, short h, short r,
+        unsigned short c) {
+    tft_fillRect(x + r, y, w - 2 * r, h, c);
+    tft_fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, c);
+    tft_fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, c);
+}
+
+// one shape drawn both ways on a cleared screen, 0 if the frames match
+static int circle_same(int r, int x, int y) {
+    static unsigned short ref[EMU_HEIGHT][EMU_WIDTH];
+    int pass;
+
+    for (pass = 0; pass < 2; pass++) {
+        tft_fillScreen(ILI9340_BLACK);
+        if (pass) {
+            tft_fillCircle(x, y, r, ILI9340_RED);
+            tft_fillRoundRect(x - 100, y - r, 2 * r + 7, 2 * r + 3 + r % 5,
+                              r, ILI9340_GREEN);
+        } else {
+            old_fillCircle(x, y, r, ILI9340_RED);
+            old_fillRoundRect(x - 100, y - r, 2 * r + 7, 2 * r + 3 + r % 5,
+                              r, ILI9340_GREEN);
+        }
+        if (!pass) memcpy(ref, emu_frame, sizeof(ref));
+    }
+    return memcmp(ref, emu_frame, sizeof(ref)) != 0;
+}
+
+// every radius the table covers and past it, then over the right and
+// bottom edges (the old code does not clip on the left and top)
+static int circle_check(void) {
+    int r, bad = 0;
+
+    for (r = 0; r <= 70; r++) bad += circle_same(r, 140, 160);
+    for (r = 0; r < 8; r++) bad += circle_same(10 + r, 235 - r, 315 - 2 * r);
+    // tft_fillCircleBg() against a square and a circle
+    for (r = 0; r <= 70; r++) {
+        static unsigned short ref[EMU_HEIGHT][EMU_WIDTH];
+        tft_fillScreen(ILI9340_BLACK);
+        tft_fillRect(120 - r, 160 - r, 2 * r + 1, 2 * r + 1, ILI9340_BLUE);
+        tft_fillCircle(120, 160, r, ILI9340_RED);
+        memcpy(ref, emu_frame, sizeof(ref));
+        tft_fillScreen(ILI9340_BLACK);
+        tft_fillCircleBg(120, 160, r, ILI9340_RED, ILI9340_BLUE);
+        bad += memcmp(ref, emu_frame, sizeof(ref)) != 0;
+    }
+    return bad;
+}
+
+static void bench_circle(void) {
+    struct bench_mark m;
+    unsigned long b;
+    int i;
+
+    printf("circle: filled circles and rounded rectangles from span tables\n");
+    printf("  %d of 150 shapes differ from the reference pixels\n",
+           circle_check());
+
+    // the animation ball: erase at the old place, draw at the new one
+    tft_fillScreen(ILI9340_BLACK);
+    b = bus_bytes();
+    mark(&m);
+    for (i = 0; i < 100; i++) {
+        old_fillCircle(20 + i, 100, 4, ILI9340_BLACK);
+        old_fillCircle(21 + i, 100, 4, ILI9340_GREEN);
+    }
+    report("ball r=4 x100, VLine pairs", &m);
+    printf("  %lu bytes per move\n", (bus_bytes() - b) / 100);
+    b = bus_bytes();
+    mark(&m);
+    for (i = 0; i < 100; i++) {
+        tft_fillCircle(20 + i, 140, 4, ILI9340_BLACK);
+        tft_fillCircle(21 + i, 140, 4, ILI9340_GREEN);
+    }
+    report("ball r=4 x100, spans", &m);
+    printf("  %lu bytes per move\n", (bus_bytes() - b) / 100);
+    // a one pixel step: the new square covers all but one column of the old
+    b = bus_bytes();
+    mark(&m);
+    for (i = 0; i < 100; i++) {
+        tft_fillRect(20 + i - 4, 180 - 4, 1, 9, ILI9340_BLACK);
+        tft_fillCircleBg(21 + i, 180, 4, ILI9340_GREEN, ILI9340_BLACK);
+    }
+    report("ball r=4 x100, one window", &m);
+    printf("  %lu bytes per move\n", (bus_bytes() - b) / 100);
+
+    // printLine() erase
+    b = bus_bytes();
+    mark(&m);
+    for (i = 0; i < 20; i++)
+        old_fillRoundRect(0, 10 * i, 239, 8, 1, ILI9340_BLACK);
+    report("printLine erase x20, helper", &m);
+    printf("  %lu bytes each\n", (bus_bytes() - b) / 20);
+    b = bus_bytes();
+    mark(&m);
+    for (i = 0; i < 20; i++)
+        tft_fillRoundRect(0, 10 * i, 239, 8, 1, ILI9340_BLACK);
+    report("printLine erase x20, spans", &m);
+    printf("  %lu bytes each\n", (bus_bytes() - b) / 20);
+}
+
+// === sprite: save-under sprites over a grid, 30 fps frames ============
+#define SPR_N     16
+#define SPR_BALL  16
+
+// background: dark blue with a grid every 20 pixels
+static void grid_row(short x, short y, short w, unsigned short *out) {
+    for (; w > 0; w--, x++)
+        *out++ = (x % 20 == 0 || y % 20 == 0) ? 0x4208 : 0x0008;
+}
+
+static unsigned short ball_pix[SPR_BALL * SPR_BALL];
+static const unsigned char arrow_bits[8] = {
+    0x18, 0x3c, 0x7e, 0xff, 0x18, 0x18, 0x18, 0x18
+};
+static struct tft_sprite spr[SPR_N];
+static unsigned short spr_under[SPR_N][SPR_BALL * SPR_BALL];
+static short spr_vx[SPR_N], spr_vy[SPR_N];
+
+static void sprite_step(int n) {
+    int i;
+    for (i = 0; i < n; i++) {
+        short x = spr[i].x + spr_vx[i], y = spr[i].y + spr_vy[i];
+        if (x < 0 || x > 240 - spr[i].w) { spr_vx[i] = -spr_vx[i]; x = spr[i].x; }
+        if (y < 0 || y > 320 - spr[i].h) { spr_vy[i] = -spr_vy[i]; y = spr[i].y; }
+        tft_spriteMove(&spr[i], x, y);
+    }
+}
+
+// what the screen should show: background, then the sprites in order
+static int sprite_check(int n) {
+    static unsigned short ref[EMU_HEIGHT][EMU_WIDTH];
+    int i, x, y;
+
+    for (y = 0; y < EMU_HEIGHT; y++) grid_row(0, y, EMU_WIDTH, ref[y]);
+    for (i = 0; i < n; i++) {
+        struct tft_sprite *s = &spr[i];
+        for (y = 0; y < s->h; y++)
+            for (x = 0; x < s->w; x++) {
+                unsigned short c;
+                if (s->pix) {
+                    c = s->pix[y * s->w + x];
+                    if (s->keyed && c == s->key) continue;
+                } else {
+                    if (!(s->bits[y] & (0x80 >> x))) continue;
+                    c = s->color[1];
+                }
+                ref[s->y + y][s->x + x] = c;
+            }
+    }
+    return memcmp(ref, emu_frame, sizeof(ref)) != 0;
+}
+
+static void bench_sprite(void) {
+    struct bench_mark m;
+    unsigned long b, px, bgpx;
+    sim_time_t el;
+    int i, x, y, f, frames = 60;
+    unsigned short row[EMU_WIDTH];
+
+    printf("sprite: %d save-under sprites over a grid, %d frames\n", SPR_N, frames);
+    // a round ball, magenta corners see-through
+    for (y = 0; y < SPR_BALL; y++)
+        for (x = 0; x < SPR_BALL; x++) {
+            int dx = 2 * x - SPR_BALL + 1, dy = 2 * y - SPR_BALL + 1;
+            ball_pix[y * SPR_BALL + x] = dx * dx + dy * dy > SPR_BALL * SPR_BALL ?
+                ILI9340_MAGENTA : dx + dy < -8 ? ILI9340_WHITE : ILI9340_GREEN;
+        }
+    tft_setAddrWindow(0, 0, 239, 319);
+    for (y = 0; y < EMU_HEIGHT; y++) {
+        grid_row(0, y, EMU_WIDTH, row);
+        tft_pushColors(row, EMU_WIDTH);
+    }
+    tft_spriteBegin(0, grid_row);
+    srand(7);
+    for (i = 0; i < SPR_N; i++) {
+        if (i % 4 == 3)
+            tft_spriteInit1(&spr[i], 8, 8, arrow_bits, 0, ILI9340_YELLOW,
+                            spr_under[i]);
+        else {
+            tft_spriteInit565(&spr[i], SPR_BALL, SPR_BALL, ball_pix, spr_under[i]);
+            spr[i].key = ILI9340_MAGENTA;
+            spr[i].keyed = 1;
+        }
+        spr_vx[i] = rand() % 7 - 3;
+        spr_vy[i] = rand() % 7 - 3;
+        tft_spriteAdd(&spr[i], rand() % 200, rand() % 280);
+    }
+    tft_spriteUpdate();
+    printf("  first frame %s\n", sprite_check(SPR_N) ? "DIFFERS" : "matches");
+
+    b = bus_bytes();
+    px = tft_sprite_pixels;
+    bgpx = tft_sprite_bg_pixels;
+    mark(&m);
+    for (f = 0; f < frames; f++) {
+        sprite_step(SPR_N);
+        tft_spriteUpdate();
+    }
+    el = sim_now() - m.t;
+    report("save-under sprite frames", &m);
+    printf("  frames %s the reference\n", sprite_check(SPR_N) ? "DIFFER from" : "match");
+    printf("  %.2f ms/frame, %lu bytes/frame, %lu pixels/frame (%lu from the "
+           "background function)\n", (double)el / frames / CYCLES_PER_US / 1000,
+           (bus_bytes() - b) / frames, (tft_sprite_pixels - px) / frames,
+           (tft_sprite_bg_pixels - bgpx) / frames);
+    // the model counts driver and bus time; composing in RAM is extra
+    printf("  %.0f sprite moves/s, %.0f sprites per 30 fps frame before the "
+           "compose time\n", (double)SPR_N * frames * 40e6 / el,
+           (double)SPR_N * frames * 40e6 / el / 30);
+
+    // the old way: erase with a black disk, draw at the new place
+    tft_fillScreen(ILI9340_BLACK);
+    b = bus_bytes();
+    mark(&m);
+    for (f = 0; f < frames; f++)
+        for (i = 0; i < SPR_N; i++) {
+            tft_fillCircle(20 + 10 * (i % 4) + f, 20 + 70 * (i / 4), 7, ILI9340_BLACK);
+            tft_fillCircle(21 + 10 * (i % 4) + f, 21 + 70 * (i / 4), 7, ILI9340_GREEN);
+        }
+    el = sim_now() - m.t;
+    report("erase and redraw, r=7 disks", &m);
+    printf("  %.2f ms/frame, %lu bytes/frame, and the background is lost\n",
+           (double)el / frames / CYCLES_PER_US / 1000, (bus_bytes() - b) / frames);
+}
+
+// === line: span runs vs one pixel at a time ===========================
+// tft_drawLine() as it was: Bresenham through tft_drawPixel()
+static void old_drawLine(short x0, short y0, short x1, short y1,
+        unsigned short color) {
+    short t, steep = abs(y1 - y0) > abs(x1 - x0), dx, dy, err, ystep;
+    if (steep) { t = x0; x0 = y0; y0 = t; t = x1; x1 = y1; y1 = t; }
+    if (x0 > x1) { t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+    dx = x1 - x0;
+    dy = abs(y1 - y0);
+    err = dx / 2;
+    ystep = y0 < y1 ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+        if (steep) tft_drawPixel(y0, x0, color);
+        else       tft_drawPixel(x0, y0, color);
+        err -= dy;
+        if (err < 0) { y0 += ystep; err += dx; }
+    }
+}
+
+#define TRACE_N 240
+
+static void bench_line(void) {
+    static unsigned short ref[EMU_HEIGHT][EMU_WIDTH];
+    static short lx[400][4], tx[TRACE_N], ty[TRACE_N];
+    struct bench_mark m;
+    unsigned long b, b_old = 1, b_new;
+    int i, pass;
+
+    printf("line: Bresenham runs as fast lines, polylines\n");
+    // random lines, some reaching off the screen, and the special cases
+    srand(3);
+    for (i = 0; i < 400; i++) {
+        lx[i][0] = rand() % 300 - 30;
+        lx[i][1] = rand() % 380 - 30;
+        lx[i][2] = i % 4 == 0 ? lx[i][0] : rand() % 300 - 30;
+        lx[i][3] = i % 4 == 1 ? lx[i][1] :
+                   i % 4 == 2 ? lx[i][1] + (lx[i][2] - lx[i][0]) :
+                   rand() % 380 - 30;
+    }
+    for (pass = 0; pass < 2; pass++) {
+        tft_fillScreen(ILI9340_BLACK);
+        b = bus_bytes();
+        mark(&m);
+        for (i = 0; i < 400; i++) {
+            if (pass) tft_drawLine(lx[i][0], lx[i][1], lx[i][2], lx[i][3], i * 163);
+            else      old_drawLine(lx[i][0], lx[i][1], lx[i][2], lx[i][3], i * 163);
+        }
+        report(pass ? "400 lines, runs" : "400 lines, pixels", &m);
+        printf("  %lu bytes\n", bus_bytes() - b);
+        if (!pass) memcpy(ref, emu_frame, sizeof(ref));
+    }
+    printf("  frames %s\n", memcmp(ref, emu_frame, sizeof(ref)) ? "DIFFER" : "identical");
+
+    // a scope trace: a sine with noise, one point per column
+    for (i = 0; i < TRACE_N; i++) {
+        tx[i] = i;
+        ty[i] = 160 + (short)(100 * sin(i * 0.05)) + rand() % 5 - 2;
+    }
+    for (pass = 0; pass < 3; pass++) {
+        tft_fillScreen(ILI9340_BLACK);
+        b = bus_bytes();
+        mark(&m);
+        if (pass == 2)
+            tft_drawPolyline(tx, ty, TRACE_N, ILI9340_GREEN);
+        else
+            for (i = 1; i < TRACE_N; i++) {
+                if (pass) tft_drawLine(tx[i-1], ty[i-1], tx[i], ty[i], ILI9340_GREEN);
+                else      old_drawLine(tx[i-1], ty[i-1], tx[i], ty[i], ILI9340_GREEN);
+            }
+        report(pass == 2 ? "trace, tft_drawPolyline" :
+               pass ? "trace, drawLine runs" : "trace, drawLine pixels", &m);
+        if (!pass) {
+            memcpy(ref, emu_frame, sizeof(ref));
+            b_old = bus_bytes() - b;
+            printf("  %lu bytes\n", b_old);
+        } else {
+            b_new = bus_bytes() - b;
+            printf("  %lu bytes (%.1fx less), frame %s\n", b_new,
+                   (double)b_old / b_new,
+                   memcmp(ref, emu_frame, sizeof(ref)) ? "DIFFERS" : "identical");
+        }
+    }
+}
+
+// === scope: strip chart columns at 2 kHz ==============================
+#define SCOPE_RATE 2000     // samples per second
+static struct tft_scope scope;
+
+static void scope_signal(int n, short *v) {
+    v[0] = (short)(500 * sin(n * 0.031)) + rand() % 21 - 10;
+    v[1] = (n / 150) % 2 ? 300 : -300;
+}
+
+// the color plot column k, row r should have
+static unsigned short scope_pixel(struct tft_scope *s, short k, short r) {
+    // as shown: HWSCROLL draws like SWEEP, the panel scrolls it
+    short i = s->mode != TFT_SCOPE_SWEEP ? (s->head + k) % s->w : k, ch;
+    unsigned short c = (i % s->gx == 0 || r % s->gy == 0) ? s->grid : s->bg;
+    for (ch = 0; ch < s->channels; ch++)
+        if (s->top[ch][i] <= r && r <= s->bot[ch][i]) c = s->color[ch];
+    return c;
+}
+
+// compare the plot with the history; screen column/row of plot pixel
+// (k,r) depend on the rotation
+static int scope_check(struct tft_scope *s, int landscape) {
+    static unsigned short shown[EMU_HEIGHT][EMU_WIDTH];
+    short k, r;
+    int bad = 0;
+
+    emu_screen(shown);
+    for (k = 0; k < s->w; k++)
+        for (r = 0; r < s->h; r++) {
+            unsigned short c = landscape ?
+                shown[s->x + k][239 - (s->y + r)] : shown[s->y + r][s->x + k];
+            if (c != scope_pixel(s, k, r)) bad++;
+        }
+    return bad;
+}
+
+static void scope_run(const char *name, unsigned char mode, int n) {
+    struct bench_mark m;
+    sim_time_t el, next, busy = 0;
+    short v[2];
+    int i, landscape = mode == TFT_SCOPE_HWSCROLL;
+
+    tft_setRotation(landscape ? 1 : 0);
+    tft_fillScreen(ILI9340_BLACK);
+    if (landscape) tft_scopeBegin(&scope, 0, 20, 320, 200, 2, mode, -600, 600);
+    else           tft_scopeBegin(&scope, 0, 40, 240, 240, 2, mode, -600, 600);
+    scope.bytes = 0;
+    srand(5);
+    mark(&m);
+    next = sim_now();
+    for (i = 0; i < n; i++) {
+        sim_time_t t;
+        // the next sample is due; the rest of the period goes to others
+        if (sim_now() < next) sim_idle(next - sim_now());
+        next += 40000000 / SCOPE_RATE;
+        t = sim_now();
+        scope_signal(i, v);
+        tft_scopeSample(&scope, v);
+        busy += sim_now() - t;
+    }
+    el = sim_now() - m.t;
+    report(name, &m);
+    printf("  %.1f us/sample, %lu bytes/sample, %.1f screens/s at %d Hz, "
+           "%s", (double)busy / n / CYCLES_PER_US, scope.bytes / n,
+           (double)scope.frames * 40e6 / el, SCOPE_RATE,
+           busy < el ? "keeps up" : "FALLS BEHIND");
+    printf(", %d pixels wrong\n", scope_check(&scope, landscape));
+    tft_scopeEnd(&scope);
+}
+
+static void bench_scope(void) {
+    printf("scope: 2-channel trace, one column per sample\n");
+    scope_run("sweep, 2400 samples", TFT_SCOPE_SWEEP, 2400);
+    scope_run("hw scroll, 2400 samples", TFT_SCOPE_HWSCROLL, 2400);
+    scope_run("sw scroll, 200 samples", TFT_SCOPE_SCROLL, 200);
+    tft_setRotation(0);
+}
+
+// === bitmap: decoded into windows vs one pixel at a time ==============
+#define BMP_W 96
+#define BMP_H 64
+
+static unsigned char bmp_idx[BMP_W * BMP_H];
+static unsigned char bmp_1[BMP_H][(BMP_W + 7) / 8];
+static unsigned char bmp_4[BMP_H][BMP_W / 2];
+static unsigned char bmp_rle[2 * BMP_W * BMP_H];
+static const unsigned short bmp_pal[8] = { ILI9340_BLACK, ILI9340_WHITE,
+    ILI9340_RED, ILI9340_GREEN, ILI9340_BLUE, ILI9340_YELLOW, ILI9340_CYAN,
+    ILI9340_MAGENTA };
+static const unsigned short bmp_pal1[2] = { ILI9340_BLUE, ILI9340_YELLOW };
+// some of it on the screen, some off each edge
+static const short bmp_at[][2] = { {20, 30}, {150, 200}, {-30, -10}, {200, 290} };
+
+// a logo: striped disk and a frame, index 0 around them
+static unsigned long bitmap_make(void) {
+    unsigned char *o = bmp_rle;
+    int x, y, i, n;
+
+    for (y = 0; y < BMP_H; y++)
+        for (x = 0; x < BMP_W; x++) {
+            int dx = x - 48, dy = y - 32, v = 0;
+            if (dx * dx + dy * dy < 900) v = 2 + (x / 6 + y / 10) % 6;
+            else if (y < 3 || y >= BMP_H - 3) v = 1;
+            bmp_idx[y * BMP_W + x] = v;
+            if (v) bmp_1[y][x / 8] |= 0x80 >> (x % 8);
+            bmp_4[y][x / 2] |= x & 1 ? v : v << 4;
+        }
+    // as host/png2bitmap.c codes it
+    for (i = 0; i < BMP_W * BMP_H; i += n) {
+        for (n = 1; i + n < BMP_W * BMP_H && n < 271 &&
+             bmp_idx[i + n] == bmp_idx[i]; n++) ;
+        *o++ = (bmp_idx[i] << 4) | (n < 16 ? n - 1 : 15);
+        if (n >= 16) *o++ = n - 16;
+    }
+    return o - bmp_rle;
+}
+
+// what a drawn image should look like, one pixel at a time
+static void bitmap_ref(const unsigned short *pal, int key) {
+    int p, x, y;
+
+    tft_fillScreen(ILI9340_BLACK);
+    for (p = 0; p < 4; p++)
+        for (y = 0; y < BMP_H; y++)
+            for (x = 0; x < BMP_W; x++) {
+                int v = bmp_idx[y * BMP_W + x];
+                if (pal == bmp_pal1) v = v != 0;
+                if (v != key)
+                    tft_drawPixel(bmp_at[p][0] + x, bmp_at[p][1] + y, pal[v]);
+            }
+}
+
+// tft_drawBitmap() as it was: tft_drawPixel() per set bit
+static void old_drawBitmap(short x, short y, const unsigned char *bitmap,
+        short w, short h, unsigned short color) {
+    short i, j, byteWidth = (w + 7) / 8;
+    for (j = 0; j < h; j++)
+        for (i = 0; i < w; i++)
+            if (bitmap[j * byteWidth + i / 8] & (128 >> (i & 7)))
+                tft_drawPixel(x + i, y + j, color);
+}
+
+static void bitmap_run(const char *name, const struct tft_bitmap *b,
+        int old) {
+    static unsigned short ref[EMU_HEIGHT][EMU_WIDTH];
+    struct bench_mark m;
+    unsigned long px = tft_bitmap_pixels, bytes;
+    sim_time_t el;
+    int p;
+
+    if (old) bitmap_ref(bmp_pal1, 0);
+    else     bitmap_ref(b->palette, b->key);
+    memcpy(ref, emu_frame, sizeof(ref));
+    tft_fillScreen(ILI9340_BLACK);
+    bytes = bus_bytes();
+    mark(&m);
+    for (p = 0; p < 4; p++) {
+        if (old == 1)
+            old_drawBitmap(bmp_at[p][0], bmp_at[p][1], bmp_1[0], BMP_W, BMP_H,
+                           ILI9340_YELLOW);
+        else if (old)
+            tft_drawBitmap(bmp_at[p][0], bmp_at[p][1], bmp_1[0], BMP_W, BMP_H,
+                           ILI9340_YELLOW);
+        else
+            tft_bitmapDraw(bmp_at[p][0], bmp_at[p][1], b);
+    }
+    el = sim_now() - m.t;
+    report(name, &m);
+    if (old) {
+        // the set bits that land on the screen
+        int x, y;
+        px = 0;
+        for (p = 0; p < 4; p++)
+            for (y = 0; y < BMP_H; y++)
+                for (x = 0; x < BMP_W; x++)
+                    px += bmp_idx[y * BMP_W + x] &&
+                          bmp_at[p][0] + x >= 0 && bmp_at[p][0] + x < 240 &&
+                          bmp_at[p][1] + y >= 0 && bmp_at[p][1] + y < 320;
+    } else px = tft_bitmap_pixels - px;
+    printf("  %lu pixels, %.0f pixels/s, %lu bytes, frame %s\n", px,
+           px * 40e6 / el, bus_bytes() - bytes,
+           memcmp(ref, emu_frame, sizeof(ref)) ? "DIFFERS" : "identical");
+}
+
+static void bench_bitmap(void) {
+    struct tft_bitmap b;
+    unsigned long rle = bitmap_make();
+
+    printf("bitmap: %dx%d logo at 4 places, partly off the screen\n",
+           BMP_W, BMP_H);
+    printf("  flash: 1bpp %u, 4bpp %u, rle %lu bytes\n",
+           (unsigned)sizeof(bmp_1), (unsigned)sizeof(bmp_4), rle);
+    bitmap_run("drawBitmap, pixels", NULL, 1);
+    bitmap_run("drawBitmap, runs", NULL, 2);
+
+    b.w = BMP_W;
+    b.h = BMP_H;
+    b.format = TFT_BITMAP_1BPP;
+    b.key = -1;
+    b.palette = bmp_pal1;
+    b.data = bmp_1[0];
+    bitmap_run("1bpp", &b, 0);
+    b.key = 0;
+    bitmap_run("1bpp, keyed", &b, 0);
+    b.format = TFT_BITMAP_4BPP;
+    b.key = -1;
+    b.palette = bmp_pal;
+    b.data = bmp_4[0];
+    bitmap_run("4bpp", &b, 0);
+    b.key = 0;
+    bitmap_run("4bpp, keyed", &b, 0);
+    b.format = TFT_BITMAP_RLE;
+    b.key = -1;
+    b.data = bmp_rle;
+    bitmap_run("rle", &b, 0);
+    b.key = 0;
+    bitmap_run("rle, keyed", &b, 0);
+}
+
+// === font: compiled fonts vs glcdfont text at sizes 1-4 ===============
+static const struct tft_font *font_by_size[4] = {
+    &tft_font8, &tft_font16, &tft_font24aa, &tft_font32
+};
+
+// a string pixel by pixel, as tft_font.h describes the format
+static void font_ref(short x, short y, const char *s,
+        const struct tft_font *f, unsigned short color, unsigned short bg) {
+    unsigned short shade[4];
+    short l, i, j, w;
+
+    for (l = 0; l < 4; l++)
+        shade[l] = (((bg >> 11) * (3 - l) + (color >> 11) * l) / 3) << 11 |
+            ((((bg >> 5) & 63) * (3 - l) + ((color >> 5) & 63) * l) / 3) << 5 |
+            ((bg & 31) * (3 - l) + (color & 31) * l) / 3;
+    for (; *s; s++, x += w) {
+        const unsigned char *g = f->data + f->offset[*s - f->first];
+        w = f->width[*s - f->first];
+        for (j = 0; j < f->height; j++)
+            for (i = 0; i < w; i++) {
+                const unsigned char *row = g + j * ((w * f->bpp + 7) / 8);
+                l = f->bpp == 1 ? ((row[i / 8] >> (7 - i % 8)) & 1) * 3 :
+                    (row[i / 4] >> (6 - 2 * (i % 4))) & 3;
+                if (color != bg) tft_drawPixel(x + i, y + j, shade[l]);
+                else if (l >= 2) tft_drawPixel(x + i, y + j, color);
+            }
+    }
+}
+
+// opaque, clipped on each side, transparent, and inside tiles
+static int font_check(const struct tft_font *f) {
+    static unsigned short ref[EMU_HEIGHT][EMU_WIDTH];
+    static const char txt[] = "Volts: 12.34 Wq/";
+    int pass, bad = 0;
+
+    for (pass = 0; pass < 4; pass++) {
+        tft_fillScreen(ILI9340_BLACK);
+        if (pass == 3) tft_tileBegin(ILI9340_BLACK);
+        tft_fontDrawString(3, 10, txt, f, ILI9340_YELLOW, ILI9340_BLUE);
+        tft_fontDrawString(-7, -5, txt, f, ILI9340_WHITE, 0x4208);
+        tft_fontDrawString(150, 310, txt, f, ILI9340_GREEN, ILI9340_BLACK);
+        tft_fontDrawString(5, 100, txt, f, ILI9340_RED, ILI9340_RED);
+        if (pass == 3) tft_tileEnd();
+        memcpy(ref, emu_frame, sizeof(ref));
+        tft_fillScreen(ILI9340_BLACK);
+        font_ref(3, 10, txt, f, ILI9340_YELLOW, ILI9340_BLUE);
+        font_ref(-7, -5, txt, f, ILI9340_WHITE, 0x4208);
+        font_ref(150, 310, txt, f, ILI9340_GREEN, ILI9340_BLACK);
+        font_ref(5, 100, txt, f, ILI9340_RED, ILI9340_RED);
+        bad += memcmp(ref, emu_frame, sizeof(ref)) != 0;
+    }
+    return bad;
+}
+
+static void bench_font(void) {
+    struct bench_mark m;
+    sim_time_t t[3];
+    unsigned long bytes[3], b;
+    char buf[20], name[40];
+    int size, pass, i;
+
+    printf("font: a readout 100 times, glcdfont at size n vs a compiled font\n");
+    for (size = 1; size <= 4; size++) {
+        const struct tft_font *f = font_by_size[size - 1];
+        for (pass = 0; pass < 3; pass++) {
+            tft_fillScreen(ILI9340_BLACK);
+            tft_setTextMode(pass ? TEXT_STRING : TEXT_CELL);
+            tft_setTextSize(size);
+            tft_setTextColor2(ILI9340_YELLOW, ILI9340_BLACK);
+            tft_font_hits = tft_font_misses = 0;
+            b = bus_bytes();
+            mark(&m);
+            for (i = 0; i < 100; i++) {
+                sprintf(buf, "%6.2f V", 12.5 + (i % 7) * 0.37 - (i % 3) * 1.1);
+                if (pass == 2) {
+                    tft_fontDrawString(4, 40, buf, f, ILI9340_YELLOW, ILI9340_BLACK);
+                } else {
+                    tft_setCursor(4, 40);
+                    tft_writeString(buf);
+                }
+            }
+            t[pass] = sim_now() - m.t;
+            bytes[pass] = bus_bytes() - b;
+            sprintf(name, pass == 2 ? "size %d, %s" : pass ? "size %d, string" :
+                    "size %d, cells", size, f == &tft_font24aa ? "font24aa" :
+                    f == &tft_font8 ? "font8" : f == &tft_font16 ? "font16" : "font32");
+            report(name, &m);
+        }
+        printf("  %.1f / %.1f / %.1f us per readout, %lu / %lu / %lu bytes, "
+               "%.1fx faster than cells\n  cache hits %lu of %lu",
+               (double)t[0] / 100 / CYCLES_PER_US, (double)t[1] / 100 / CYCLES_PER_US,
+               (double)t[2] / 100 / CYCLES_PER_US, bytes[0] / 100, bytes[1] / 100,
+               bytes[2] / 100, (double)t[0] / t[2], tft_font_hits,
+               tft_font_hits + tft_font_misses);
+        printf(", %d checks wrong\n", font_check(f));
+    }
+    tft_setTextMode(TEXT_STRING);
+    tft_setTextSize(1);
+    tft_fillScreen(ILI9340_BLACK);
+    tft_fontDrawString(4, 4, "font8 Quick brown fox", &tft_font8, ILI9340_WHITE, ILI9340_BLACK);
+    tft_fontDrawString(4, 20, "font16 Quick fox", &tft_font16, ILI9340_WHITE, ILI9340_BLACK);
+    tft_fontDrawString(4, 44, "24aa Quick fox", &tft_font24aa, ILI9340_WHITE, ILI9340_BLACK);
+    tft_fontDrawString(4, 76, "32 Fox 12.3", &tft_font32, ILI9340_WHITE, ILI9340_BLACK);
+    tft_setCursor(4, 120);
+    tft_setTextSize(3);
+    tft_setTextColor2(ILI9340_WHITE, ILI9340_BLACK);
+    tft_writeString("size 3 Fox");
+    tft_setTextSize(1);
+    emu_write_png("font_sample.png");
+    printf("  wrote font_sample.png\n");
+}
+
+// === clip: viewports and clip rectangles vs a reference rasterizer ====
+// The reference plots every primitive pixel by pixel into its own frame,
+// with its own copy of the origin and clip rectangle; the driver has to
+// come out the same, and send nothing for what it does not draw.
+static unsigned short clip_ref[EMU_HEIGHT][EMU_WIDTH];
+static short cr_ox, cr_oy, cr_x0, cr_y0, cr_x1, cr_y1;
+static unsigned long cr_plotted;     // pixels inside the clip
+
+static void cr_plot(int x, int y, unsigned short c) {
+    x += cr_ox;
+    y += cr_oy;
+    if (x < cr_x0 || x >= cr_x1 || y < cr_y0 || y >= cr_y1) return;
+    clip_ref[y][x] = c;
+    cr_plotted++;
+}
+
+// the same rectangle arithmetic tft_master.h describes
+static void cr_push(int x, int y, int w, int h, int viewport) {
+    x += cr_ox;
+    y += cr_oy;
+    if (x > cr_x0) cr_x0 = x;
+    if (y > cr_y0) cr_y0 = y;
+    if (x + w < cr_x1) cr_x1 = x + w;
+    if (y + h < cr_y1) cr_y1 = y + h;
+    if (cr_x1 < cr_x0) cr_x1 = cr_x0;
+    if (cr_y1 < cr_y0) cr_y1 = cr_y0;
+    if (viewport) {
+        cr_ox = x;
+        cr_oy = y;
+    }
+}
+
+static void cr_rect(int x, int y, int w, int h, unsigned short c) {
+    int i, j;
+    for (j = 0; j < h; j++)
+        for (i = 0; i < w; i++) cr_plot(x + i, y + j, c);
+}
+
+static void cr_line(int x0, int y0, int x1, int y1, unsigned short c) {
+    int t, steep = abs(y1 - y0) > abs(x1 - x0), dx, dy, err, ystep;
+    if (steep) { t = x0; x0 = y0; y0 = t; t = x1; x1 = y1; y1 = t; }
+    if (x0 > x1) { t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+    dx = x1 - x0;
+    dy = abs(y1 - y0);
+    err = dx / 2;
+    ystep = y0 < y1 ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+        if (steep) cr_plot(y0, x0, c);
+        else       cr_plot(x0, y0, c);
+        err -= dy;
+        if (err < 0) { y0 += ystep; err += dx; }
+    }
+}
+
+// midpoint circle, outline or filled with the Adafruit column pairs
+static void cr_circle(int x0, int y0, int r, unsigned short c, int fill) {
+    int f = 1 - r, ddx = 1, ddy = -2 * r, x = 0, y = r;
+    if (fill) cr_rect(x0, y0 - r, 1, 2 * r + 1, c);
+    else {
+        cr_plot(x0, y0 + r, c); cr_plot(x0, y0 - r, c);
+        cr_plot(x0 + r, y0, c); cr_plot(x0 - r, y0, c);
+    }
+    while (x < y) {
+        if (f >= 0) { y--; ddy += 2; f += ddy; }
+        x++;
+        ddx += 2;
+        f += ddx;
+        if (fill) {
+            cr_rect(x0 + x, y0 - y, 1, 2 * y + 1, c);
+            cr_rect(x0 - x, y0 - y, 1, 2 * y + 1, c);
+            cr_rect(x0 + y, y0 - x, 1, 2 * x + 1, c);
+            cr_rect(x0 - y, y0 - x, 1, 2 * x + 1, c);
+        } else {
+            cr_plot(x0 + x, y0 + y, c); cr_plot(x0 - x, y0 + y, c);
+            cr_plot(x0 + x, y0 - y, c); cr_plot(x0 - x, y0 - y, c);
+            cr_plot(x0 + y, y0 + x, c); cr_plot(x0 - y, y0 + x, c);
+            cr_plot(x0 + y, y0 - x, c); cr_plot(x0 - y, y0 - x, c);
+        }
+    }
+}
+
+static void cr_char(int x, int y, unsigned char ch, unsigned short c,
+        unsigned short bg, int size) {
+    int i, j;
+    for (i = 0; i < 6; i++)
+        for (j = 0; j < 8; j++) {
+            int on = i < 5 && ((font[ch * 5 + i] >> j) & 1);
+            if (on || bg != c)
+                cr_rect(x + i * size, y + j * size, size, size, on ? c : bg);
+        }
+}
+
+static void cr_font(int x, int y, const char *s, const struct tft_font *f,
+        unsigned short c, unsigned short bg) {
+    int i, j, w, on;
+    for (; *s; s++, x += w) {
+        const unsigned char *g = f->data + f->offset[*s - f->first];
+        w = f->width[*s - f->first];
+        for (j = 0; j < f->height; j++)
+            for (i = 0; i < w; i++) {
+                on = (g[j * ((w + 7) / 8) + i / 8] >> (7 - i % 8)) & 1;
+                if (on || bg != c) cr_plot(x + i, y + j, on ? c : bg);
+            }
+    }
+}
+
+static const unsigned char clip_bits[2 * 12] = {
+    0x3f, 0xc0, 0x40, 0x20, 0x9f, 0x90, 0xa0, 0x50, 0xa6, 0x50, 0xa9, 0x50,
+    0xa9, 0x50, 0xa6, 0x50, 0xa0, 0x50, 0x9f, 0x90, 0x40, 0x20, 0x3f, 0xc0
+};
+
+static int clip_rnd(int lo, int hi) {
+    return lo + rand() % (hi - lo + 1);
+}
+
+// one random primitive, drawn by the driver and by the reference
+static void clip_draw(int kind) {
+    static const char *txt[] = { "Clip", "Wq/!", "12.34 V", "ab" };
+    short px[5], py[5];
+    int x = clip_rnd(-60, 160), y = clip_rnd(-60, 160);
+    int w = clip_rnd(-5, 140), h = clip_rnd(-5, 140), r = clip_rnd(0, 70);
+    int size = clip_rnd(1, 3), i;
+    unsigned short c = rand(), bg = (kind & 1) ? c : (unsigned short)rand();
+    const char *s = txt[rand() % 4];
+
+    switch (kind % 11) {
+    case 0: tft_fillRect(x, y, w, h, c); cr_rect(x, y, w, h, c); break;
+    case 1: tft_drawFastHLine(x, y, w, c); cr_rect(x, y, w, 1, c); break;
+    case 2: tft_drawFastVLine(x, y, h, c); cr_rect(x, y, 1, h, c); break;
+    case 3:
+    case 4:
+        w = clip_rnd(-200, 250);
+        h = clip_rnd(-200, 250);
+        tft_drawLine(x, y, w, h, c);
+        cr_line(x, y, w, h, c);
+        break;
+    case 5:
+        for (i = 0; i < 5; i++) {
+            px[i] = clip_rnd(-60, 160);
+            py[i] = clip_rnd(-60, 160);
+            if (i) cr_line(px[i-1], py[i-1], px[i], py[i], c);
+        }
+        tft_drawPolyline(px, py, 5, c);
+        break;
+    case 6: tft_drawCircle(x, y, r, c); cr_circle(x, y, r, c, 0); break;
+    case 7:
+        if (kind & 16) {
+            tft_fillCircleBg(x, y, r, c, bg);
+            cr_rect(x - r, y - r, 2 * r + 1, 2 * r + 1, bg);
+        } else tft_fillCircle(x, y, r, c);
+        cr_circle(x, y, r, c, 1);
+        break;
+    case 8:
+        tft_drawChar(x, y, *s, c, bg, size);
+        cr_char(x, y, *s, c, bg, size);
+        break;
+    case 9:
+        // cursor_x is unsigned: keep strings to the right of the origin
+        x = clip_rnd(0, 120);
+        tft_setCursor(x, y);
+        tft_setTextSize(size);
+        tft_setTextColor2(c, bg);
+        tft_writeString((char *)s);
+        for (i = 0; s[i]; i++) cr_char(x + i * 6 * size, y, s[i], c, bg, size);
+        break;
+    case 10:
+        if (kind & 16) {
+            tft_drawBitmap(x, y, clip_bits, 12, 12, c);
+            for (i = 0; i < 12 * 12; i++)
+                if ((clip_bits[i / 12 * 2 + i % 12 / 8] << (i % 12 % 8)) & 0x80)
+                    cr_plot(x + i % 12, y + i / 12, c);
+        } else {
+            tft_fontDrawString(x, y, s, &tft_font16, c, bg);
+            cr_font(x, y, s, &tft_font16, c, bg);
+        }
+        break;
+    }
+}
+
+#define CLIP_TRIALS 300
+#define CLIP_PRIMS  24
+
+static void bench_clip(void) {
+    struct bench_mark m;
+    unsigned long b, prims = 0, rejected = 0, leaked = 0, drawn = 0, bytes = 0;
+    sim_time_t t0, el = 0;
+    int t, k, vp, bad = 0, x, y;
+
+    printf("clip: random viewports and clip rectangles vs a reference rasterizer\n");
+    srand(18);
+    tft_setTextWrap(0);
+    for (t = 0; t < CLIP_TRIALS; t++) {
+        tft_clipReset();
+        tft_fillScreen(ILI9340_BLACK);
+        memset(clip_ref, 0, sizeof(clip_ref));
+        cr_ox = cr_oy = cr_x0 = cr_y0 = 0;
+        cr_x1 = EMU_WIDTH;
+        cr_y1 = EMU_HEIGHT;
+        // a viewport, then one or two clip rectangles or viewports in it
+        for (k = 0; k < 1 + t % 3; k++) {
+            short px = k ? clip_rnd(-30, 100) : clip_rnd(-40, 140);
+            short py = k ? clip_rnd(-30, 100) : clip_rnd(-40, 200);
+            short w = k ? clip_rnd(0, 160) : clip_rnd(40, 280);
+            short h = k ? clip_rnd(0, 160) : clip_rnd(40, 360);
+            vp = !k || (rand() & 1);
+            if (vp) tft_viewportPush(px, py, w, h);
+            else    tft_clipPush(px, py, w, h);
+            cr_push(px, py, w, h, vp);
+        }
+        for (k = 0; k < CLIP_PRIMS; k++) {
+            cr_plotted = 0;
+            b = bus_bytes();
+            t0 = sim_now();
+            clip_draw(rand());
+            el += sim_now() - t0;
+            bytes += bus_bytes() - b;
+            prims++;
+            drawn += cr_plotted;
+            if (!cr_plotted) {
+                rejected++;
+                leaked += bus_bytes() - b;
+            }
+        }
+        tft_clipPop();
+        tft_clipPop();
+        tft_clipPop();
+        // back at the whole screen: this fill must cover everything
+        tft_fillRect(-5, 300, 300, 50, ILI9340_BLACK);
+        cr_ox = cr_oy = cr_x0 = cr_y0 = 0;
+        cr_x1 = EMU_WIDTH;
+        cr_y1 = EMU_HEIGHT;
+        cr_rect(-5, 300, 300, 50, ILI9340_BLACK);
+        for (y = 0, k = 0; y < EMU_HEIGHT; y++)
+            for (x = 0; x < EMU_WIDTH; x++) k += emu_frame[y][x] != clip_ref[y][x];
+        bad += k != 0;
+    }
+    printf("  %lu primitives in %d scenes, %lu pixels inside the clip, "
+           "%d scenes differ\n", prims, CLIP_TRIALS, drawn, bad);
+    printf("  %.1f us, %lu bytes per primitive\n",
+           (double)el / prims / CYCLES_PER_US, bytes / prims);
+    printf("  %lu primitives with nothing inside: %lu bytes sent for them\n",
+           rejected, leaked);
+
+    // a 100x60 widget drawing lines that mostly run past its edges
+    for (t = 0; t < 2; t++) {
+        tft_fillScreen(ILI9340_BLACK);
+        tft_viewportPush(70, 130, 100, 60);
+        srand(5);
+        b = bus_bytes();
+        mark(&m);
+        for (k = 0; k < 400; k++) {
+            x = clip_rnd(-100, 200);
+            y = clip_rnd(-100, 160);
+            if (t) tft_drawLine(x, y, clip_rnd(-100, 200), clip_rnd(-100, 160), k * 163);
+            else   old_drawLine(x, y, clip_rnd(-100, 200), clip_rnd(-100, 160), k * 163);
+        }
+        report(t ? "400 lines in a widget, runs" : "400 lines in a widget, pixels", &m);
+        printf("  %lu bytes", bus_bytes() - b);
+        tft_clipPop();
+        if (!t) memcpy(clip_ref, emu_frame, sizeof(clip_ref));
+        else printf(", frame %s", memcmp(clip_ref, emu_frame, sizeof(clip_ref)) ?
+                    "DIFFERS" : "identical");
+        printf("\n");
+    }
+    tft_setTextWrap(1);
+    tft_setTextSize(1);
+    tft_clipReset();
+}
+
+// === columns: MADCTL column windows for bar graphs ====================
+#define BARS_FRAMES 50
+#define BARS_H      120
+
+// a spectrum-like bar graph the old ways: a fast line per column, or a
+// rectangle per bar part
+static void bars_lines(short x, short y, short h, const short *v, short n,
+        short bw, short gap, unsigned short c, unsigned short bg) {
+    short k, i, top;
+    for (k = 0; k < n; k++) {
+        top = h - v[k];
+        for (i = 0; i < bw; i++) {
+            tft_drawFastVLine(x + k * (bw + gap) + i, y, top, bg);
+            tft_drawFastVLine(x + k * (bw + gap) + i, y + top, v[k], c);
+        }
+        for (i = 0; i < gap; i++)
+            tft_drawFastVLine(x + k * (bw + gap) + bw + i, y, h, bg);
+    }
+}
+
+static void bars_rects(short x, short y, short h, const short *v, short n,
+        short bw, short gap, unsigned short c, unsigned short bg) {
+    short k;
+    for (k = 0; k < n; k++) {
+        tft_fillRect(x + k * (bw + gap), y, bw, h - v[k], bg);
+        tft_fillRect(x + k * (bw + gap), y + h - v[k], bw, v[k], c);
+        tft_fillRect(x + k * (bw + gap) + bw, y, gap, h, bg);
+    }
+}
+
+static void bench_columns(void) {
+    static unsigned short ref[EMU_HEIGHT][EMU_WIDTH];
+    static const char *way[3] = { "lines", "rects", "column window" };
+    static short v[320];
+    struct bench_mark m;
+    sim_time_t t[3];
+    unsigned long bytes[3], b, sw;
+    int r, pass, f, k, n, bw, bad = 0, sync = 0;
+    char name[48];
+
+    printf("columns: bar graphs through a MADCTL column window\n");
+    // both setRotation calls leave driver, tft_gfx and panel agreeing
+    for (r = 0; r < 8; r++) {
+        if (r & 4) tft_gfx_setRotation(r);
+        else       tft_setRotation(r);
+        sync += rotation == (r & 3) && _width == ((r & 1) ? 320 : 240) &&
+                _height == ((r & 1) ? 240 : 320) &&
+                (emu_madctl & ILI9340_MADCTL_MV) == ((r & 1) ? ILI9340_MADCTL_MV : 0);
+    }
+    printf("  rotation, size and MADCTL agree for %d of 8 setRotation calls\n", sync);
+
+    // 4-column bars (3 and a gap), then a histogram of 1-column bars
+    for (r = 0; r < 8; r++) {
+        tft_setRotation(r & 3);
+        bw = (r & 4) ? 1 : 3;
+        n = _width / (bw + (bw > 1));
+        for (pass = 0; pass < 3; pass++) {
+            tft_fillScreen(ILI9340_BLACK);
+            srand(19);
+            b = bus_bytes();
+            sw = tft_madctl_switches;
+            mark(&m);
+            for (f = 0; f < BARS_FRAMES; f++) {
+                for (k = 0; k < n; k++) v[k] = rand() % (BARS_H + 1);
+                if (pass == 2)
+                    tft_drawBars(0, 20, BARS_H, v, n, bw, bw > 1, ILI9340_GREEN, ILI9340_BLACK);
+                else if (pass)
+                    bars_rects(0, 20, BARS_H, v, n, bw, bw > 1, ILI9340_GREEN, ILI9340_BLACK);
+                else
+                    bars_lines(0, 20, BARS_H, v, n, bw, bw > 1, ILI9340_GREEN, ILI9340_BLACK);
+            }
+            // a pixel after the bars puts MADCTL back
+            tft_drawPixel(0, 0, ILI9340_BLACK);
+            t[pass] = sim_now() - m.t;
+            bytes[pass] = bus_bytes() - b;
+            if (r % 4 < 2) {
+                sprintf(name, "rot %d, %d wide, %s", r & 3, bw, way[pass]);
+                report(name, &m);
+            }
+            if (!pass) memcpy(ref, emu_frame, sizeof(ref));
+            else bad += memcmp(ref, emu_frame, sizeof(ref)) != 0;
+        }
+        if (r % 4 < 2)
+            printf("  %d bars: %.0f / %.0f / %.0f us and %lu / %lu / %lu bytes a frame, "
+                   "%.1fx faster than lines, %.1fx than rects, %lu MADCTL\n",
+                   n, (double)t[0] / BARS_FRAMES / CYCLES_PER_US,
+                   (double)t[1] / BARS_FRAMES / CYCLES_PER_US,
+                   (double)t[2] / BARS_FRAMES / CYCLES_PER_US,
+                   bytes[0] / BARS_FRAMES, bytes[1] / BARS_FRAMES,
+                   bytes[2] / BARS_FRAMES, (double)t[0] / t[2],
+                   (double)t[1] / t[2], tft_madctl_switches - sw);
+    }
+    printf("  %d of 8 frames differ from the line per column reference\n", bad);
+
+    // cut by a viewport, and with a pixel drawn between frames
+    tft_setRotation(0);
+    for (pass = 0; pass < 2; pass++) {
+        tft_fillScreen(ILI9340_BLACK);
+        tft_viewportPush(17, 31, 150, 120);
+        srand(20);
+        for (f = 0; f < 10; f++) {
+            for (k = 0; k < 50; k++) v[k] = rand() % 201;
+            if (pass) tft_drawBars(-30, -40, 200, v, 50, 3, 1, ILI9340_GREEN, ILI9340_BLUE);
+            else      bars_lines(-30, -40, 200, v, 50, 3, 1, ILI9340_GREEN, ILI9340_BLUE);
+            tft_drawPixel(f, f, ILI9340_RED);
+        }
+        tft_clipPop();
+        if (!pass) memcpy(ref, emu_frame, sizeof(ref));
+    }
+    printf("  clipped bars: frame %s\n",
+           memcmp(ref, emu_frame, sizeof(ref)) ? "DIFFERS" : "identical");
+}
+
+// === bands: a mixed scene drawn straight vs double-buffered DMA bands =
+// cpu time to draw into a band, which the simulator cannot see: a call
+// and clip per span, and a store per pixel. Charged at the end of each
+// band, while the DMA ships the one before
+#define BAND_SPAN_CYCLES  40
+#define BAND_PIXEL_CYCLES 2
+
+static short mix_tri[8][6], mix_circ[12][3];
+static unsigned long band_seen_fills, band_seen_pixels;
+static sim_time_t band_work;
+
+// text, circles and triangles over the whole screen; the same every call
+static void scene_mixed(void) {
+    static const unsigned short pal[6] = { ILI9340_RED, ILI9340_GREEN,
+        ILI9340_BLUE, ILI9340_CYAN, ILI9340_MAGENTA, ILI9340_YELLOW };
+    char line[32];
+    short i;
+
+    for (i = 0; i < 8; i++)
+        tft_fillTriangle(mix_tri[i][0], mix_tri[i][1], mix_tri[i][2],
+                         mix_tri[i][3], mix_tri[i][4], mix_tri[i][5], pal[i % 6]);
+    for (i = 0; i < 12; i++) {
+        tft_fillCircle(mix_circ[i][0], mix_circ[i][1], mix_circ[i][2],
+                       pal[(i + 3) % 6]);
+        tft_drawCircle(mix_circ[i][0], mix_circ[i][1], mix_circ[i][2] + 2,
+                       ILI9340_WHITE);
+    }
+    for (i = 0; i < 10; i++) {
+        tft_setCursor(4, 6 + 26 * i);
+        tft_setTextColor(ILI9340_WHITE);
+        tft_setTextSize((i & 1) + 1);
+        sprintf(line, "ch%d %5d mV", i, 1234 * i - 4000);
+        tft_writeString(line);
+    }
+    tft_fontDrawString(120, 280, "12.34 V", &tft_font24aa, ILI9340_YELLOW,
+                       ILI9340_BLUE);
+}
+
+static void scene_mixed_band(void) {
+    unsigned long w;
+
+    scene_mixed();
+    w = BAND_SPAN_CYCLES * (tft_band_fills - band_seen_fills) +
+        BAND_PIXEL_CYCLES * (tft_band_pixels - band_seen_pixels);
+    band_seen_fills = tft_band_fills;
+    band_seen_pixels = tft_band_pixels;
+    band_work += w;
+    sim_work(w);
+}
+
+// tft_bandRender(), spinning where the simulator sees it: tft_dmaWait()
+// polls a flag only the DMA interrupt changes, which never fires here
+// unless something enters the simulator
+static void band_render(short x, short y, short w, short h, unsigned short bg) {
+    tft_bandStart(x, y, w, h, bg, scene_mixed_band);
+    do while (tft_dmaBusy()) sim_work(4); while (tft_bandStep());
+    while (tft_dmaBusy()) sim_work(4);
+}
+
+static void bench_band(void) {
+    static unsigned short ref[EMU_HEIGHT][EMU_WIDTH];
+    struct bench_mark m;
+    sim_time_t el, bus, work;
+    unsigned long bands;
+    double serial;
+    int i, pass;
+
+    srand(20);
+    for (i = 0; i < 8; i++) {
+        mix_tri[i][0] = rand() % 280 - 20;
+        mix_tri[i][1] = rand() % 360 - 20;
+        mix_tri[i][2] = mix_tri[i][0] + rand() % 160 - 80;
+        mix_tri[i][3] = mix_tri[i][1] + rand() % 160 - 40;
+        mix_tri[i][4] = mix_tri[i][0] + rand() % 160 - 80;
+        mix_tri[i][5] = mix_tri[i][1] + rand() % 160 - 40;
+    }
+    for (i = 0; i < 12; i++) {
+        mix_circ[i][0] = rand() % 240;
+        mix_circ[i][1] = rand() % 320;
+        mix_circ[i][2] = 6 + rand() % 30;
+    }
+
+    printf("band: text + circles + triangles, full screen, straight vs "
+           "%d-pixel DMA bands\n", TFT_BAND_PIXELS);
+    mark(&m);
+    tft_fillScreen(ILI9340_BLACK);
+    scene_mixed();
+    report("immediate", &m);
+    el = sim_now() - m.t;
+    memcpy(ref, emu_frame, sizeof(ref));
+
+    // 0: spinning between bands; 1: from a thread, yielding meanwhile
+    for (pass = 0; pass < 2; pass++) {
+        tft_fillScreen(ILI9340_RED);
+        band_seen_fills = tft_band_fills;
+        band_seen_pixels = tft_band_pixels;
+        band_work = 0;
+        bands = tft_band_bands;
+        mark(&m);
+        if (pass) {
+            tft_bandStart(0, 0, _width, _height, ILI9340_BLACK, scene_mixed_band);
+            do while (tft_dmaBusy()) sim_idle(100); while (tft_bandStep());
+            while (tft_dmaBusy()) sim_idle(100);
+            report("bands, thread", &m);
+        }
+        else {
+            band_render(0, 0, _width, _height, ILI9340_BLACK);
+            report("bands", &m);
+        }
+        bus = sim.bus_cycles - m.c.bus_cycles;
+        work = band_work;
+        serial = (double)(work + bus);
+        printf("  %lu bands, %.1f ms vs %.1f ms straight; draw %.1f ms, bus "
+               "%.1f ms, overlap %.0f%% of the shorter, frame %s\n",
+               tft_band_bands - bands, (sim_now() - m.t) / 40e3, el / 40e3,
+               work / 40e3, bus / 40e3,
+               100.0 * (serial - (sim_now() - m.t)) /
+                   (work < bus ? work : bus),
+               memcmp(ref, emu_frame, sizeof(ref)) ? "DIFFERS" : "identical");
+    }
+
+    // inside a viewport: the region and the scene follow the origin
+    tft_fillScreen(ILI9340_BLACK);
+    tft_viewportPush(17, 33, 201, 251);
+    tft_fillScreen(0x0010);
+    scene_mixed();
+    tft_clipPop();
+    memcpy(ref, emu_frame, sizeof(ref));
+    tft_fillScreen(ILI9340_BLACK);
+    tft_viewportPush(17, 33, 201, 251);
+    band_render(0, 0, 201, 251, 0x0010);
+    tft_clipPop();
+    printf("  in a 201x251 viewport: frame %s\n",
+           memcmp(ref, emu_frame, sizeof(ref)) ? "DIFFERS" : "identical");
+}
+
+static const struct {
+    const char *name;
+    void (*fn)(void);
+} benches[] = {
+    { "fill", bench_fill },
+    { "window", bench_window },
+    { "pixel", bench_pixel },
+    { "tile", bench_tile },
+    { "text", bench_text },
+    { "string", bench_string },
+    { "console", bench_console },
+    { "width", bench_width },
+    { "begin", bench_begin },
+    { "rotate", bench_rotate },
+    { "circle", bench_circle },
+    { "sprite", bench_sprite },
+    { "line", bench_line },
+    { "scope", bench_scope },
+    { "bitmap", bench_bitmap },
+    { "font", bench_font },
+    { "field", bench_field },
+    { "clip", bench_clip },
+    { "columns", bench_columns },
+    { "band", bench_band },
+};
+
+int main(int argc, char **argv) {
+    unsigned int i;
+
+    emu_attach();
+    tft_init_hw();
+    tft_begin();
+    tft_setRotation(0);
+
+    for (i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+        if (argc > 1 && strcmp(argv[1], benches[i].name)) continue;
+        sim_reset();
+        benches[i].fn();
+    }
+    return 0;
+}
@@ -0,0 +1,7 @@
+/*
+ * File:   xc.h  (host stand-in)
+ *
+ * The device registers live in the plib.h stand-in next to this file.
+ */
+
+#include "plib.h"
@@ -540,13 +540,44 @@ struct pt_sem {
 
 // macro to time a thread execution interveal in millisec
 // max time 4000 sec
+// Under SCHED_SLEEP the thread also goes to sleep until then: the
+// scheduler does not call it at all before time_thread, see pt_sleep_until
 
 #define PT_YIELD_TIME_msec(delay_time)  \
     do { static unsigned int time_thread ;\
     time_thread = time_tick_millsec + (unsigned int)delay_time ; \
+    pt_sleep_until(time_thread); \
     PT_YIELD_UNTIL(pt, (time_tick_millsec >= time_thread)); \
     } while(0);
 
+// macro for a thread added with pt_add_periodic(): ends this period's job
+// and yields until the next release, period after period without drift.
+// Use it in the thread function itself, not in a spawned thread: it finds
+// the thread's entry from pt
+#define PT_YIELD_PERIOD(pt) \
+    do { pt_job_done((struct ptx *)(pt)); \
+    PT_YIELD_UNTIL(pt, (time_tick_millsec >= ((struct ptx *)(pt))->release)); \
+    } while(0);
+
+// macro to yield until cond, like PT_YIELD_UNTIL, for a cond that an ISR
+// makes true. Under SCHED_SLEEP the thread stops being ready while it
+// waits, and is not called again until the ISR does PT_READY(thread);
+// see PT_GetSerialBuffer and its UART2 RX ISR
+// -- a cond already true keeps the thread ready through the one yield
+#define PT_YIELD_UNTIL_EVENT(pt, cond) \
+  do { \
+    PT_YIELD_FLAG = 0; \
+    LC_SET((pt)->lc); \
+    pt_wait_event(); \
+    if(!(cond)) { \
+      return PT_YIELDED; \
+    } \
+    pt_event_done(); \
+    if(PT_YIELD_FLAG == 0) { \
+      return PT_YIELDED; \
+    } \
+  } while(0)
+
 // macro to return system time
 #define PT_GET_TIME() (time_tick_millsec)
 
@@ -627,21 +658,66 @@ static struct pt pt_sched ;
 // count of defined tasks
 int pt_task_count = 0 ;
 
+// system time, updated in the TIMER1 ISR further down
+extern volatile unsigned int time_tick_millsec ;
+
+// late jobs by how late, in msec: bin k counts 2^k to 2^(k+1)-1,
+// the last bin everything later
+#define PT_TARDY_BINS 8
+
 // The task structure
+// -- pt comes first: PT_YIELD_PERIOD gets from a thread's pt to its entry
 struct ptx {
 	struct pt pt;              // thread context
 	int num;                    // thread number
 	char (*pf)(struct pt *pt); // pointer to thread function
     int rate;
+    unsigned int wake;          // SCHED_SLEEP: time_tick_millsec to wake at
+    char asleep;                // SCHED_SLEEP: in the sleep heap
+    // periodic threads (pt_add_periodic), all times in msec
+    unsigned int period;        // 0: not periodic
+    unsigned int deadline;      // relative to each release
+    unsigned int release, due;  // this job's release and absolute deadline
+    unsigned int jobs, misses;  // jobs done, and done after their deadline
+    unsigned short tardy[PT_TARDY_BINS] ;
+#ifdef use_thread_profile
+    // profiler, in core timer ticks (sys_clock/2)
+    unsigned int prof_calls ;           // times called
+    unsigned long long prof_ticks ;     // inside the thread, in total
+    unsigned int prof_max ;             // longest single call
+    unsigned int prof_last ;            // end of the last call
+#endif
 };
 
 // === extended structure for scheduler ===============
 // an array of task structures
 #define MAX_THREADS 10
+
+// === ready set (SCHED_SLEEP) ===
+// bit n set: thread n can run. Threads start out ready, and stop being
+// ready in PT_YIELD_TIME_msec (until their time comes) and in
+// PT_YIELD_UNTIL_EVENT (until an ISR readies them again).
+// Set and clear bits only through these two, from ISRs or threads:
+// they turn interrupts off around the read-modify-write
+// A thread made ready also gets the core timer stamped in pt_ready_at[],
+// for the dispatch latency of SCHED_PRIORITY
+volatile unsigned int pt_ready = 0 ;
+volatile unsigned int pt_ready_at[MAX_THREADS] ;
+#define PT_READY(thread_num) \
+    do { int pt_n = (thread_num); \
+    unsigned int pt_int_status = INTDisableInterrupts(); \
+    if (!(pt_ready & (1u << pt_n))) pt_ready_at[pt_n] = ReadCoreTimer(); \
+    pt_ready |= 1u << pt_n; \
+    INTRestoreInterrupts(pt_int_status); } while(0)
+#define PT_UNREADY(thread_num) \
+    do { unsigned int pt_int_status = INTDisableInterrupts(); \
+    pt_ready &= ~(1u << (thread_num)); \
+    INTRestoreInterrupts(pt_int_status); } while(0)
 static struct ptx pt_thread_list[MAX_THREADS];
 // see https://github.com/edartuz/c-ptx/tree/master/src
 // and the license above
 // add an entry to the thread list
+// -- rate is the SCHED_RATE rate, or the SCHED_PRIORITY priority
 //struct ptx *pt_add( char (*pf)(struct pt *pt), int rate) {
 int pt_add( char (*pf)(struct pt *pt), int rate) {
 	if (pt_task_count < (MAX_THREADS)) {
@@ -653,6 +729,16 @@ int pt_add( char (*pf)(struct pt *pt), int rate) {
 		ptx->pf    = pf;
         // rate scheduler rate
         ptx->rate  = rate ; 
+        ptx->asleep = 0 ;
+        ptx->period = 0 ;
+        ptx->jobs = ptx->misses = 0 ;
+        memset(ptx->tardy, 0, sizeof(ptx->tardy)) ;
+#ifdef use_thread_profile
+        ptx->prof_calls = ptx->prof_max = 0 ;
+        ptx->prof_ticks = 0 ;
+        ptx->prof_last = ReadCoreTimer() ;
+#endif
+        PT_READY(ptx->num) ;
 		PT_INIT( &ptx->pt );
         // count of number of defined threads
 		pt_task_count++;
@@ -662,6 +748,23 @@ int pt_add( char (*pf)(struct pt *pt), int rate) {
 	return NULL;
 }
 
+// add a thread that runs once every period msec, each job due deadline
+// msec after its release; the first release is now. The thread ends each
+// job with PT_YIELD_PERIOD. SCHED_EDF runs the job due first, the other
+// schedulers just call the thread when its release comes.
+// Returns the thread number, or -1 when the thread list is full
+int pt_add_periodic( char (*pf)(struct pt *pt), unsigned int period,
+        unsigned int deadline) {
+    struct ptx *ptx ;
+    if (pt_task_count >= MAX_THREADS) return -1 ;
+    ptx = &pt_thread_list[pt_add(pf, 0)] ;
+    ptx->period = period ;
+    ptx->deadline = deadline ;
+    ptx->release = time_tick_millsec ;
+    ptx->due = ptx->release + deadline ;
+    return ptx->num ;
+}
+
 /* Scheduler
 Copyright (c) 2014 edartuz
 
@@ -692,10 +795,286 @@ SOFTWARE.
 // choose schedule method
 #define SCHED_ROUND_ROBIN 0
 #define SCHED_RATE 1
+// round robin over the ready threads: a thread in PT_YIELD_TIME_msec
+// sleeps in a min-heap of wake times and is not called again until
+// time_tick_millsec reaches its time, one in PT_YIELD_UNTIL_EVENT until
+// an ISR readies it. With nothing ready the cpu waits for an interrupt
+#define SCHED_SLEEP 2
+// as SCHED_SLEEP, but one thread at a time: the ready thread with the
+// best priority (pt_add rate, 0 highest) runs next. Waiting raises a
+// thread one level every PT_AGING dispatches, so no thread starves
+#define SCHED_PRIORITY 3
+// earliest deadline first, one thread at a time, on the SCHED_SLEEP
+// ready set: the ready periodic thread whose job is due first runs next,
+// the other threads take turns when no periodic job is ready
+#define SCHED_EDF 4
 int pt_sched_method = SCHED_ROUND_ROBIN ;
 
+// === sleeping threads (SCHED_SLEEP) ===
+// thread being run by the scheduler, NULL outside it
+static struct ptx *pt_running = NULL ;
+// binary min-heap of sleeping thread numbers, earliest wake time on top
+static unsigned char pt_sleep_heap[MAX_THREADS] ;
+static int pt_sleep_count = 0 ;
+
+// drop thread n into the heap at hole i, moving it up or down to where
+// its wake time belongs
+static void pt_sleep_place(int i, int n) {
+    unsigned int wake = pt_thread_list[n].wake ;
+    int up, child ;
+    while (i > 0 && wake < pt_thread_list[pt_sleep_heap[up = (i - 1) / 2]].wake) {
+        pt_sleep_heap[i] = pt_sleep_heap[up] ;
+        i = up ;
+    }
+    while ((child = 2 * i + 1) < pt_sleep_count) {
+        if (child + 1 < pt_sleep_count &&
+            pt_thread_list[pt_sleep_heap[child + 1]].wake <
+            pt_thread_list[pt_sleep_heap[child]].wake) child++ ;
+        if (wake <= pt_thread_list[pt_sleep_heap[child]].wake) break ;
+        pt_sleep_heap[i] = pt_sleep_heap[child] ;
+        i = child ;
+    }
+    pt_sleep_heap[i] = n ;
+}
+
+// put the running thread to sleep until time_tick_millsec >= wake
+// -- does nothing outside SCHED_SLEEP, where threads poll their timers
+void pt_sleep_until(unsigned int wake) {
+    struct ptx *ptx = pt_running ;
+    int k, last ;
+    if (ptx == NULL) return ;
+    // readied early by an ISR and now sleeping again: take out the old time
+    if (ptx->asleep) {
+        for (k = 0; pt_sleep_heap[k] != ptx->num; k++) ;
+        last = pt_sleep_heap[--pt_sleep_count] ;
+        if (k < pt_sleep_count) pt_sleep_place(k, last) ;
+    }
+    ptx->wake = wake ;
+    ptx->asleep = 1 ;
+    PT_UNREADY(ptx->num) ;
+    pt_sleep_place(pt_sleep_count++, ptx->num) ;
+}
+
+// take the thread that wakes first off the heap
+static int pt_sleep_pop(void) {
+    int top = pt_sleep_heap[0] ;
+    int last = pt_sleep_heap[--pt_sleep_count] ;
+    if (pt_sleep_count) pt_sleep_place(0, last) ;
+    pt_thread_list[top].asleep = 0 ;
+    return top ;
+}
+
+// PT_YIELD_UNTIL_EVENT: stop being ready before testing the condition,
+// so an ISR that makes it true in between still readies the thread, and
+// be ready again once past it
+void pt_wait_event(void) {
+    if (pt_running) PT_UNREADY(pt_running->num) ;
+}
+void pt_event_done(void) {
+    if (pt_running) PT_READY(pt_running->num) ;
+}
+
+// thread the scheduler is running, -1 outside SCHED_SLEEP: what an
+// event waiter tells its ISR to ready
+int pt_self(void) {
+    return pt_running ? pt_running->num : -1 ;
+}
+
+// === idle time (SCHED_SLEEP) ===
+// with no thread ready the scheduler waits for the next interrupt (the
+// MIPS wait instruction, Timer1 at the latest), counting core timer
+// ticks (sys_clock/2) spent running in between. An ISR that readies a
+// thread just between the test and the wait is seen an interrupt later
+static unsigned long long pt_busy_ticks ;
+static unsigned int pt_wake_ticks, pt_idle_since ;
+unsigned int pt_waits ;
+#define PT_TICKS_TO_USEC(ticks) ((ticks) / (sys_clock / 2000000))
+
+// start counting idle time afresh
+void pt_idle_reset(void) {
+    pt_busy_ticks = 0 ;
+    pt_waits = 0 ;
+    pt_wake_ticks = ReadCoreTimer() ;
+    pt_idle_since = time_tick_millsec ;
+}
+
+// percent of the time since pt_idle_reset() spent in wait
+int pt_idle_percent(void) {
+    unsigned long long busy = pt_busy_ticks + (ReadCoreTimer() - pt_wake_ticks) ;
+    unsigned long long all = (unsigned long long)(time_tick_millsec - pt_idle_since) *
+        (sys_clock / 2000) ;
+    if (all == 0 || busy >= all) return 0 ;
+    return 100 - (int)(100 * busy / all) ;
+}
+
+// wake every sleeping thread whose time has come, earliest first
+static void pt_sleep_wake(void) {
+    while (pt_sleep_count &&
+           time_tick_millsec >= pt_thread_list[pt_sleep_heap[0]].wake)
+        PT_READY(pt_sleep_pop()) ;
+}
+
+// nothing ready: sleep until an interrupt, and say so
+static char pt_idle_wait(void) {
+    if (pt_ready) return 0 ;
+    pt_busy_ticks += ReadCoreTimer() - pt_wake_ticks ;
+    asm("wait");
+    pt_wake_ticks = ReadCoreTimer() ;
+    pt_waits++ ;
+    return 1 ;
+}
+
+// === thread profiler (use_thread_profile in config_1_3_2.h) ===
+// The scheduler calls every thread through PT_CALL. With the profiler on
+// that reads the core timer before and after, and adds up the calls and
+// time of each thread; with it off PT_CALL is the bare call
+#ifdef use_thread_profile
+// time_tick_millsec when the counts were last zeroed
+static unsigned int pt_profile_since ;
+
+static void pt_profile_end(struct ptx *ptx, unsigned int start) {
+    unsigned int now = ReadCoreTimer() ;
+    ptx->prof_calls++ ;
+    ptx->prof_ticks += now - start ;
+    if (now - start > ptx->prof_max) ptx->prof_max = now - start ;
+    ptx->prof_last = now ;
+}
+#define PT_CALL(ptx) \
+    do { unsigned int pt_call_start = ReadCoreTimer(); \
+    ((ptx)->pf)(&(ptx)->pt); \
+    pt_profile_end(ptx, pt_call_start); } while(0)
+
+// zero the counts of every thread
+void pt_profile_reset(void) {
+    int i ;
+    for (i=0; i<pt_task_count; i++) {
+        pt_thread_list[i].prof_calls = 0 ;
+        pt_thread_list[i].prof_ticks = 0 ;
+        pt_thread_list[i].prof_max = 0 ;
+        pt_thread_list[i].prof_last = ReadCoreTimer() ;
+    }
+    pt_profile_since = time_tick_millsec ;
+}
+
+// one row of a top-like table, under PT_PROFILE_HEADER: calls, share of
+// the time since pt_profile_reset(), mean and longest call, and how long
+// ago the thread last ran
+#define PT_PROFILE_HEADER "thread     calls   cpu%  mean_us   max_us  ago_ms\r\n"
+void pt_profile_string(char *buf, int thread_num) {
+    struct ptx *ptx = &pt_thread_list[thread_num] ;
+    unsigned int ms = time_tick_millsec - pt_profile_since ;
+    sprintf(buf, "%6d %9u %6.1f %8.1f %8u %7u\r\n", thread_num, ptx->prof_calls,
+        ms ? (float)ptx->prof_ticks / ((float)ms * (sys_clock / 2000)) * 100 : 0.0,
+        ptx->prof_calls ? (float)ptx->prof_ticks / ptx->prof_calls / (sys_clock / 2000000) : 0.0,
+        PT_TICKS_TO_USEC(ptx->prof_max),
+        (ReadCoreTimer() - ptx->prof_last) / (sys_clock / 2000)) ;
+}
+#else
+#define PT_CALL(ptx) ((ptx)->pf)(&(ptx)->pt)
+#endif
+
+// === priorities (SCHED_PRIORITY) ===
+// priorities 0 (highest) to PT_PRIORITIES-1; larger rates count as the lowest
+#define PT_PRIORITIES 8
+// dispatches a ready thread waits for each level it is raised by
+#define PT_AGING 16
+// dispatches each thread has waited while ready
+static unsigned int pt_waited[MAX_THREADS] ;
+// worst time from ready to running, per priority, in core timer ticks
+// (sys_clock/2); zero it with pt_latency_reset()
+unsigned int pt_latency_max[PT_PRIORITIES] ;
+
+void pt_latency_reset(void) {
+    memset(pt_latency_max, 0, sizeof(pt_latency_max)) ;
+}
+
+// the ready thread to run next: best aged priority, then the one that
+// has waited longest, so equal priorities take turns
+static int pt_priority_pick(void) {
+    unsigned int ready = pt_ready ;
+    int i, level, best = -1, best_level = 0 ;
+    for (i=0; i<pt_task_count; i++) {
+        if (!(ready & (1u << i))) continue ;
+        level = pt_thread_list[i].rate - (int)(pt_waited[i] / PT_AGING) ;
+        if (level < 0) level = 0 ;
+        if (best < 0 || level < best_level ||
+            (level == best_level && pt_waited[i] > pt_waited[best])) {
+            best = i ;
+            best_level = level ;
+        }
+        pt_waited[i]++ ;
+    }
+    pt_waited[best] = 0 ;
+    return best ;
+}
+
+// run thread i, charging its wait to the latency of its priority
+static void pt_priority_run(int i) {
+    struct ptx *ptx = &pt_thread_list[i] ;
+    int pri = ptx->rate < PT_PRIORITIES ? ptx->rate : PT_PRIORITIES - 1 ;
+    unsigned int now = ReadCoreTimer() ;
+    if (now - pt_ready_at[i] > pt_latency_max[pri])
+        pt_latency_max[pri] = now - pt_ready_at[i] ;
+    pt_running = ptx ;
+    PT_CALL(ptx);
+    pt_running = NULL ;
+    // still ready (it only yielded): waiting again from now
+    pt_ready_at[i] = ReadCoreTimer() ;
+}
+
+// === deadlines (periodic threads) ===
+// the job of a periodic thread is done: count it, late or not, and sleep
+// until the next release (unless that has passed already)
+void pt_job_done(struct ptx *ptx) {
+    unsigned int late = time_tick_millsec - ptx->due ;
+    int bin ;
+    ptx->jobs++ ;
+    if ((int)late > 0) {
+        ptx->misses++ ;
+        for (bin = 0; bin < PT_TARDY_BINS - 1 && (late >> (bin + 1)); bin++) ;
+        ptx->tardy[bin]++ ;
+    }
+    ptx->release += ptx->period ;
+    ptx->due = ptx->release + ptx->deadline ;
+    if ((int)(ptx->release - time_tick_millsec) > 0) pt_sleep_until(ptx->release) ;
+}
+
+// zero the job, miss and tardiness counts of every thread
+void pt_deadline_reset(void) {
+    int i ;
+    for (i=0; i<pt_task_count; i++) {
+        pt_thread_list[i].jobs = pt_thread_list[i].misses = 0 ;
+        memset(pt_thread_list[i].tardy, 0, sizeof(pt_thread_list[i].tardy)) ;
+    }
+}
+
+#define PT_GET_JOBS(thread_num) pt_thread_list[thread_num].jobs
+#define PT_GET_MISSES(thread_num) pt_thread_list[thread_num].misses
+#define PT_GET_TARDY(thread_num, bin) pt_thread_list[thread_num].tardy[bin]
+
+// the ready periodic thread due first, else the next ready other thread
+static int pt_edf_pick(void) {
+    static int next = 0 ;
+    unsigned int ready = pt_ready ;
+    int i, best = -1 ;
+    for (i=0; i<pt_task_count; i++) {
+        if (!(ready & (1u << i)) || pt_thread_list[i].period == 0) continue ;
+        if (best < 0 || (int)(pt_thread_list[i].due - pt_thread_list[best].due) < 0)
+            best = i ;
+    }
+    if (best >= 0) return best ;
+    for (i=0; i<pt_task_count; i++) {
+        best = (next + i) % pt_task_count ;
+        if (ready & (1u << best)) break ;
+    }
+    next = best + 1 ;
+    return best ;
+}
+
 #define PT_SET_RATE(thread_num, new_rate) pt_thread_list[thread_num].rate = new_rate
 #define PT_GET_RATE(thread_num) pt_thread_list[thread_num].rate 
+#define PT_SET_PRIORITY(thread_num, pri) PT_SET_RATE(thread_num, pri)
+#define PT_GET_PRIORITY(thread_num) PT_GET_RATE(thread_num)
 
 static PT_THREAD (protothread_sched(struct pt *pt))
 {   
@@ -715,7 +1094,7 @@ static PT_THREAD (protothread_sched(struct pt *pt))
           // -- separated using comma operator. But it can have only one condition.
           for (i=0; i<pt_task_count; i++, ptx++ ){
               // call thread function
-              (pt_thread_list[i].pf)(&ptx->pt); 
+              PT_CALL(ptx); 
           }
           // Never yields! 
           // NEVER exit while!
@@ -740,13 +1119,62 @@ static PT_THREAD (protothread_sched(struct pt *pt))
                 (rate==3 && ((pt_pri_count & 0b111)==0)) | 
                 (rate==4 && ((pt_pri_count & 0b1111)==0))){
                 // call thread function
-                    (pt_thread_list[i].pf)(&ptx->pt); 
+                    PT_CALL(ptx); 
                 }
             }
           // Never yields! 
           // NEVER exit while!
         } // END WHILE(1)
     } //end if (pt_sched_method==SCHED_RATE)       
+    
+    else if (pt_sched_method==SCHED_SLEEP){
+        pt_idle_reset();
+        while(1) {
+            pt_sleep_wake();
+            if (pt_idle_wait()) continue ;
+            // round-robin on the ready threads
+            struct ptx *ptx = &pt_thread_list[0];
+            for (i=0; i<pt_task_count; i++, ptx++ ){
+                if (!(pt_ready & (1u << i))) continue ;
+                pt_running = ptx ;
+                PT_CALL(ptx);
+            }
+            pt_running = NULL ;
+          // Never yields! 
+          // NEVER exit while!
+        } // END WHILE(1)
+    } //end if (pt_sched_method==SCHED_SLEEP)
+
+    else if (pt_sched_method==SCHED_PRIORITY){
+        pt_idle_reset();
+        pt_latency_reset();
+        memset(pt_waited, 0, sizeof(pt_waited)) ;
+        while(1) {
+            pt_sleep_wake();
+            if (pt_idle_wait()) continue ;
+            // one thread, then look again: one that just became ready
+            // goes ahead of the ones that only yielded
+            pt_priority_run(pt_priority_pick());
+          // Never yields! 
+          // NEVER exit while!
+        } // END WHILE(1)
+    } //end if (pt_sched_method==SCHED_PRIORITY)
+
+    else if (pt_sched_method==SCHED_EDF){
+        pt_idle_reset();
+        while(1) {
+            pt_sleep_wake();
+            if (pt_idle_wait()) continue ;
+            // one thread, then look again: a job released meanwhile may
+            // be due sooner
+            struct ptx *ptx = &pt_thread_list[pt_edf_pick()];
+            pt_running = ptx ;
+            PT_CALL(ptx);
+            pt_running = NULL ;
+          // Never yields! 
+          // NEVER exit while!
+        } // END WHILE(1)
+    } //end if (pt_sched_method==SCHED_EDF)
      
     PT_END(pt);
 } // scheduler thread
@@ -779,6 +1207,8 @@ static PT_THREAD (protothread_sched(struct pt *pt))
 #define normal_text printf("\x1b[0m")
 // The following thread definitions are necessary for UART control
 static struct pt pt_input, pt_output, pt_DMA_output, pt_DMA_input ;
+// SCHED_SLEEP: threads waiting for UART2 RX data and for the DMA1 send
+static int pt_rx_thread = -1, pt_tx_thread = -1 ;
 
 //====================================================================
 // build a string from the UART2 /////////////
@@ -801,7 +1231,15 @@ int PT_GetSerialBuffer(struct pt *pt)
         // get the character
         // yield until there is a valid character so that other
         // threads can execute
-        PT_YIELD_UNTIL(pt, UARTReceivedDataIsAvailable(UART2));
+        // -- under SCHED_SLEEP the RX interrupt readies this thread
+        // -- clearing a flag left from a character already read first,
+        // -- or it fires at once and masks the interrupt again
+        pt_rx_thread = pt_self();
+        if (pt_rx_thread >= 0) {
+            INTClearFlag(INT_U2RX);
+            INTEnable(INT_U2RX, INT_ENABLED);
+        }
+        PT_YIELD_UNTIL_EVENT(pt, UARTReceivedDataIsAvailable(UART2));
        // while(!UARTReceivedDataIsAvailable(UART2)){};
         character = UARTGetDataByte(UART2);
         PT_YIELD_UNTIL(pt, UARTTransmitterIsReady(UART2));
@@ -962,10 +1400,18 @@ int PT_DMA_PutSerialBuffer(struct pt *pt)
     UARTSendDataByte(UART2, PT_send_buffer[0]);
     //DmaChnStartTxfer(DMA_CHANNEL1, DMA_WAIT_NOT, 0);
     // start the DMA
+    // -- clearing block-done first, or the wait below sees the last string's
+    // -- under SCHED_SLEEP the block-done interrupt readies this thread
+    DmaChnClrEvFlags(DMA_CHANNEL1, DMA_EV_BLOCK_DONE);
+    pt_tx_thread = pt_self();
+    if (pt_tx_thread >= 0) {
+        INTClearFlag(INT_DMA1);
+        INTEnable(INT_DMA1, INT_ENABLED);
+    }
     DmaChnEnable(DMA_CHANNEL1);
     // wait for DMA done
     //mPORTBClearBits(BIT_0);
-    PT_YIELD_UNTIL(pt, DmaChnGetEvFlags(DMA_CHANNEL1) & DMA_EV_BLOCK_DONE);
+    PT_YIELD_UNTIL_EVENT(pt, DmaChnGetEvFlags(DMA_CHANNEL1) & DMA_EV_BLOCK_DONE);
     //wait until the transmit buffer is empty
     PT_YIELD_UNTIL(pt, U2STA&0x100);
     
@@ -974,6 +1420,25 @@ int PT_DMA_PutSerialBuffer(struct pt *pt)
     // and indicate the end of the thread
     PT_END(pt);
 }
+
+//====================================================================
+// === serial wake-ups for SCHED_SLEEP ===============================
+// Each ISR readies the thread waiting on it and masks itself: the
+// RX and DMA flags stay up until the thread has dealt with them, and
+// the thread unmasks the interrupt when it next waits
+void __ISR(_UART_2_VECTOR, IPL2AUTO) U2Handler(void)
+{
+    INTEnable(INT_U2RX, INT_DISABLED);
+    INTClearFlag(INT_U2RX);
+    if (pt_rx_thread >= 0) PT_READY(pt_rx_thread);
+}
+
+void __ISR(_DMA_1_VECTOR, IPL2AUTO) DMA1Handler(void)
+{
+    INTEnable(INT_DMA1, INT_DISABLED);
+    INTClearFlag(INT_DMA1);
+    if (pt_tx_thread >= 0) PT_READY(pt_tx_thread);
+}
 //#endif //#ifdef use_uart_serial
 
 //======================================================================
@@ -1042,6 +1507,10 @@ void PT_setup (void)
   // set null as ending character (of a string)
   DmaChnSetMatchPattern(DMA_CHANNEL1, 0x00);
   
+  // interrupt levels for the SCHED_SLEEP wake-ups, enabled as needed
+  INTSetVectorPriority(INT_UART_2_VECTOR, INT_PRIORITY_LEVEL_2);
+  INTSetVectorPriority(INT_DMA_1_VECTOR, INT_PRIORITY_LEVEL_2);
+  
   
   //===================================================
   
@@ -0,0 +1,123 @@
+/*
+ * File:   tft_band.c
+ * Double-buffered band renderer for the TFT, see tft_band.h
+ *
+ * Each step first hands the band drawn last time to the DMA, then draws
+ * the next band into the other buffer while that one goes out. The DMA
+ * must be idle when a step starts, which also means the buffer about to
+ * be drawn into has been sent.
+ */
+
+#include "plib.h"
+#include "tft_master.h"
+#include "tft_band.h"
+
+static unsigned short band_buf[2][TFT_BAND_PIXELS];
+static void (*band_draw)(void);
+static unsigned short band_bg;
+static short band_x, band_w, band_y1;   // region, in screen coordinates
+static short band_rows;                 // rows in a full band
+static short band_next;                 // first row not drawn yet
+static short band_top, band_h;          // band being drawn, or waiting
+static unsigned char band_cur;                // buffer it is in
+static char band_pending = 0;           // drawn but not handed to the DMA
+
+void tft_bandFill(short x, short y, short w, short h, unsigned short color) {
+/* Fill a rectangle in the band being drawn
+ * Parameters: same as tft_fillRect(), in screen coordinates
+ * Returns:     Nothing
+ * Note: this is the tft_fill_hook while a band is drawn
+ */
+    unsigned short *buf = band_buf[band_cur];
+    unsigned short i, j, k;
+
+    // the band clip has done this already; the tile paths of fonts and
+    // bitmaps call the hook straight after their own clip test
+    if (x < band_x) { w -= band_x - x; x = band_x; }
+    if (y < band_top) { h -= band_top - y; y = band_top; }
+    if (x + w > band_x + band_w) w = band_x + band_w - x;
+    if (y + h > band_top + band_h) h = band_top + band_h - y;
+    if ((w <= 0) || (h <= 0)) return;
+    tft_band_fills++;
+    tft_band_pixels += (unsigned long)w * h;
+
+    for (j = 0; j < h; j++) {
+        k = (y - band_top + j) * band_w + (x - band_x);
+        for (i = 0; i < w; i++, k++) buf[k] = color;
+    }
+}
+
+void tft_bandStart(short x, short y, short w, short h, unsigned short bg,
+        void (*draw)(void)) {
+/* Set up a region to be rendered band by band with tft_bandStep()
+ * Parameters:
+ *      x, y, w, h: the region, as tft_fillRect()
+ *      bg:         color each band starts out with
+ *      draw:       draws the scene; called once per band
+ * Returns:     Nothing
+ */
+    band_draw = draw;
+    band_bg = bg;
+    band_pending = 0;
+    band_next = band_y1 = 0;
+    if (!tft_clipRect(&x, &y, &w, &h)) return;
+    band_x = x;
+    band_w = w;
+    band_rows = TFT_BAND_PIXELS / w;
+    band_next = y;
+    band_y1 = y + h;
+}
+
+char tft_bandStep(void) {
+/* Send the band drawn last, and draw the next one while it goes out
+ * Returns: nonzero while there is more to do, 0 once the last band has
+ *      been handed to the DMA
+ * Note: call only while tft_dmaBusy() is 0 (PT_TFT_BANDS does both). The
+ *      last band is still being sent when this returns 0: the next tft_
+ *      call that needs SPI1 waits for it, as after tft_fillRectDMA()
+ */
+    void (*hook)(short, short, short, short, unsigned short) = tft_fill_hook;
+    unsigned short *buf;
+    unsigned short n, i;
+
+    if (band_pending) {
+        tft_setAddrWindow(band_x, band_top, band_x + band_w - 1,
+                          band_top + band_h - 1);
+        tft_pushColorsDMA(band_buf[band_cur], (unsigned long)band_w * band_h);
+        band_pending = 0;
+        band_cur ^= 1;
+    }
+    if (band_next >= band_y1) return 0;
+
+    band_top = band_next;
+    band_h = band_y1 - band_top;
+    if (band_h > band_rows) band_h = band_rows;
+    band_next += band_h;
+    n = band_w * band_h;
+    buf = band_buf[band_cur];
+    for (i = 0; i < n; i++) buf[i] = band_bg;
+    tft_band_pixels += n;
+
+    // the band as the clip rectangle, in the caller's coordinates
+    tft_clipPush(band_x - tft_org_x, band_top - tft_org_y, band_w, band_h);
+    tft_fill_hook = tft_bandFill;
+    band_draw();
+    tft_fill_hook = hook;
+    tft_clipPop();
+
+    band_pending = 1;
+    tft_band_bands++;
+    return 1;
+}
+
+void tft_bandRender(short x, short y, short w, short h, unsigned short bg,
+        void (*draw)(void)) {
+/* Render a region band by band, outside a thread
+ * Parameters: as tft_bandStart()
+ * Returns:     Nothing
+ * Note: spins on the DMA between bands, and returns with the last band
+ *      still being sent. From a thread use PT_TFT_BANDS instead
+ */
+    tft_bandStart(x, y, w, h, bg, draw);
+    do tft_dmaWait(); while (tft_bandStep());
+}
@@ -0,0 +1,50 @@
+/*
+ * File:   tft_band.h
+ * Double-buffered band renderer for the TFT
+ *
+ * Drawing straight to the panel makes the cpu wait on SPI1 for every
+ * span, and the tile renderer (tft_tile.h) sends its tiles with the cpu
+ * pushing each word. Here a region of the screen is rendered as a stack
+ * of bands, a few scanlines tall, into two RAM buffers in turn: while the
+ * DMA ships one band to the panel, the cpu draws the next into the other.
+ *
+ * The scene is a function that draws with the usual tft_ calls. It runs
+ * once per band, with the clip rectangle set to the band (see
+ * tft_clipPush() in tft_master.h), so it must draw the same thing every
+ * time it is called: set the text cursor and colors inside it.
+ *
+ *      static void scene(void) { ...tft_fillCircle(), tft_writeString()... }
+ *      ...
+ *      PT_TFT_BANDS(pt, 0, 0, 240, 320, ILI9340_BLACK, scene);
+ * Bands start out filled with bg. The region is relative to the current
+ * origin and cut to the current clip rectangle, like a tft_fillRect().
+ */
+
+#ifndef TFT_BAND_H
+#define TFT_BAND_H
+
+// pixels in each of the two band buffers, 4*TFT_BAND_PIXELS bytes of RAM
+// together. A band is as many whole rows of the region as fit
+#ifndef TFT_BAND_PIXELS
+#define TFT_BAND_PIXELS 2560
+#endif
+
+void tft_bandStart(short x, short y, short w, short h, unsigned short bg,
+        void (*draw)(void));
+char tft_bandStep(void);
+void tft_bandRender(short x, short y, short w, short h, unsigned short bg,
+        void (*draw)(void));
+void tft_bandFill(short x, short y, short w, short h, unsigned short color);
+
+// render a region from a thread, yielding while the DMA ships each band
+#define PT_TFT_BANDS(pt, x, y, w, h, bg, draw) \
+    do { \
+        tft_bandStart(x, y, w, h, bg, draw); \
+        PT_WAIT_UNTIL(pt, !tft_dmaBusy() && !tft_bandStep()); \
+    } while (0)
+
+// bands drawn, spans handed to tft_bandFill(), and pixels stored in the
+// band buffers (the bg fill of each band included)
+unsigned long tft_band_bands, tft_band_fills, tft_band_pixels;
+
+#endif /* TFT_BAND_H */
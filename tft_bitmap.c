@@ -0,0 +1,145 @@
+/*
+ * File:   tft_bitmap.c
+ * Paletted and run-length coded images, see tft_bitmap.h
+ *
+ * Each visible row is decoded into bmp_row, one palette index per screen
+ * column, then sent as runs. Opaque images go out as one window for the
+ * whole visible part; with a key each stretch of shown pixels in a row
+ * is its own window, so the see-through ones are never written.
+ */
+
+#include <string.h>
+#include "plib.h"
+#include "tft_master.h"
+#include "tft_bitmap.h"
+
+static unsigned char bmp_row[ILI9340_TFTHEIGHT];   // indices of one row
+
+// RLE decoder state: index and pixels left of the current run
+static const unsigned char *rle_p;
+static unsigned char rle_idx;
+static unsigned short rle_left;
+
+// pixels waiting to be sent as one run
+static unsigned short bmp_color;
+static unsigned long bmp_run;
+
+// read the next run of an RLE image
+static void tft_bitmapRle(void) {
+    unsigned char c = *rle_p++;
+
+    rle_idx = c >> 4;
+    rle_left = (c & 15) + 1;
+    if (rle_left == 16) rle_left += *rle_p++;
+}
+
+// indices of columns i0..i1 of image row j into bmp_row[0..]. RLE images
+// must be read row after row, so there i0 > i1 just skips a row
+static void tft_bitmapRow(const struct tft_bitmap *b, short j, short i0,
+        short i1) {
+    const unsigned char *p;
+    unsigned char *o = bmp_row;
+    short i, n, a, e;
+
+    if (b->format == TFT_BITMAP_1BPP) {
+        p = b->data + j * ((b->w + 7) / 8);
+        for (i = i0; i <= i1; i++) *o++ = (p[i >> 3] >> (~i & 7)) & 1;
+    } else if (b->format == TFT_BITMAP_4BPP) {
+        p = b->data + j * ((b->w + 1) / 2);
+        for (i = i0; i <= i1; i++)
+            *o++ = (i & 1) ? p[i >> 1] & 15 : p[i >> 1] >> 4;
+    } else {
+        for (i = 0; i < b->w; i += n) {
+            if (!rle_left) tft_bitmapRle();
+            n = (rle_left < b->w - i) ? rle_left : b->w - i;
+            rle_left -= n;
+            // the part of the run inside i0..i1
+            a = (i > i0) ? i : i0;
+            e = (i + n - 1 < i1) ? i + n - 1 : i1;
+            if (a <= e) memset(bmp_row + a - i0, rle_idx, e - a + 1);
+        }
+    }
+}
+
+// add n pixels of color c to the stream, merging equal neighbours
+static void tft_bitmapPut(unsigned short c, unsigned long n) {
+    if ((c != bmp_color) && bmp_run) {
+        tft_pushRun(bmp_color, bmp_run);
+        bmp_run = 0;
+    }
+    bmp_color = c;
+    bmp_run += n;
+}
+
+static void tft_bitmapEnd(void) {
+// send the last run of a window
+    tft_pushRun(bmp_color, bmp_run);
+    bmp_run = 0;
+}
+
+// send bmp_row[0..n-1] of a row at screen (x,y), leaving key pixels alone
+static void tft_bitmapKeyed(const struct tft_bitmap *b, short x, short y,
+        short n) {
+    const unsigned short *pal = b->palette;
+    short i, a, e;
+
+    for (i = 0; i < n; ) {
+        if (bmp_row[i] == b->key) {
+            i++;
+            continue;
+        }
+        for (a = i; (i < n) && (bmp_row[i] != b->key); i++) ;
+        tft_bitmap_pixels += i - a;
+        if (tft_fill_hook) {
+            // tiles take rectangles, already clipped: one per run
+            for (; a < i; a = e) {
+                for (e = a + 1; (e < i) && (bmp_row[e] == bmp_row[a]); e++) ;
+                tft_fill_hook(x + a, y, e - a, 1, pal[bmp_row[a]]);
+            }
+            continue;
+        }
+        tft_setAddrWindow(x + a, y, x + i - 1, y);
+        for (e = a; e < i; e++) tft_bitmapPut(pal[bmp_row[e]], 1);
+        tft_bitmapEnd();
+    }
+}
+
+void tft_bitmapDraw(short x, short y, const struct tft_bitmap *b) {
+/* Draw an image with its top left corner at (x,y)
+ * Parameters:
+ *      x, y:   top left corner, may be outside the clip rectangle
+ *      b:      the image, see tft_bitmap.h
+ * Returns:     Nothing
+ * Note: an opaque image goes out as one address window over its visible
+ *      part, streamed as runs of equal pixels. With b->key >= 0, or
+ *      inside tft_tileBegin(), rows go out piece by piece instead
+ */
+    short x0 = x, y0 = y, n = b->w, rows = b->h, x1, y1, j, i;
+    char opaque = (b->key < 0) && !tft_fill_hook;
+
+    // visible part in screen coordinates; x and y follow the origin
+    if (!tft_clipRect(&x0, &y0, &n, &rows)) return;
+    x += tft_org_x;
+    y += tft_org_y;
+    x1 = x0 + n - 1;
+    y1 = y0 + rows - 1;
+
+    if (b->format == TFT_BITMAP_RLE) {
+        rle_p = b->data;
+        rle_left = 0;
+        for (j = 0; j < y0 - y; j++) tft_bitmapRow(b, j, b->w, -1);
+    }
+    if (opaque) {
+        tft_setAddrWindow(x0, y0, x1, y1);
+        tft_bitmap_pixels += (unsigned long)n * (y1 - y0 + 1);
+    }
+    for (j = y0 - y; j <= y1 - y; j++) {
+        tft_bitmapRow(b, j, x0 - x, x1 - x);
+        if (!opaque) {
+            tft_bitmapKeyed(b, x0, y + j, n);
+            continue;
+        }
+        for (i = 0; i < n; i++) tft_bitmapPut(b->palette[bmp_row[i]], 1);
+    }
+    if (opaque) tft_bitmapEnd();
+}
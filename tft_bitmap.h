@@ -0,0 +1,53 @@
+/*
+ * File:   tft_bitmap.h
+ * Paletted and run-length coded images for the TFT
+ *
+ * An image is a table of palette indices in flash, decoded straight into
+ * one address window: nothing is unpacked to RAM but one row of indices,
+ * and neighbouring pixels of one color go out as one run.
+ *
+ * Formats:
+ *  TFT_BITMAP_1BPP     (w+7)/8 bytes a row, most significant bit on the
+ *                      left; a two color palette
+ *  TFT_BITMAP_4BPP     (w+1)/2 bytes a row, high nibble on the left; up to
+ *                      16 colors
+ *  TFT_BITMAP_RLE      4-bit indices in runs, row after row with runs
+ *                      going on into the next row. A byte is the index in
+ *                      its high nibble and the run length less one in its
+ *                      low nibble; low nibble 15 means a run of 16 plus the
+ *                      next byte, up to 271 pixels
+ *
+ * With key set to a palette index, pixels of that index are left alone:
+ * each row then goes out as one window per stretch of other pixels.
+ * Images are clipped to the screen.
+ *
+ * host/png2bitmap.c turns a PNG into such an image as C source, e.g.
+ *      png2bitmap -n logo logo.png logo.c
+ * gives
+ *      extern const struct tft_bitmap logo;
+ *      tft_bitmapDraw(10, 20, &logo);
+ * Inside tft_tileBegin() / tft_tileEnd() the runs go to the tiles as
+ * rectangles.
+ */
+
+#ifndef TFT_BITMAP_H
+#define TFT_BITMAP_H
+
+#define TFT_BITMAP_1BPP 0
+#define TFT_BITMAP_4BPP 1
+#define TFT_BITMAP_RLE  2
+
+struct tft_bitmap {
+    short w, h;                         // size in pixels
+    unsigned char format;               // TFT_BITMAP_...
+    signed char key;                    // see-through palette index, or -1
+    const unsigned short *palette;      // RGB565 colors by index
+    const unsigned char *data;          // indices, as the format says
+};
+
+void tft_bitmapDraw(short x, short y, const struct tft_bitmap *b);
+
+// pixels drawn by tft_bitmapDraw(), see-through ones not counted
+unsigned long tft_bitmap_pixels;
+
+#endif /* TFT_BITMAP_H */
@@ -0,0 +1,187 @@
+/*
+ * File:   tft_console.c
+ * Scrolling text console for the TFT, see tft_console.h
+ *
+ * Text line n lives in strip n % con_rows of the scroll area. Each strip
+ * remembers how far right its old text reaches, so a recycled strip only
+ * gets the part the new line does not cover erased. VT100 escape
+ * sequences (colors, cursor moves) in mirrored serial output are skipped.
+ *
+ * The console works in GRAM rows, so it draws with the origin and clip
+ * rectangle set to the whole screen, whatever viewport the caller has
+ * pushed, and puts them back afterwards.
+ */
+
+#include "plib.h"
+#include "tft_master.h"
+#include "tft_gfx.h"
+#include "tft_console.h"
+
+static unsigned short con_top, con_rows, con_lh, con_cols;
+static unsigned char con_size;
+static unsigned short con_color, con_bg;
+static unsigned short con_col;          // cursor column, in characters
+static unsigned short con_end;          // right edge (pixels) of this line
+static char con_esc;                    // 1 after ESC, 2 inside ESC [ ...
+// right edge (pixels) of what may still be drawn in each strip, old
+// lines included
+static unsigned short con_used[TFT_CONSOLE_MAXROWS];
+// the caller's origin and clip rectangle while the console draws
+static short con_org_x, con_org_y, con_clip[4];
+
+static void tft_consoleScreen(void) {
+    con_org_x = tft_org_x;
+    con_org_y = tft_org_y;
+    con_clip[0] = tft_clip_x0;
+    con_clip[1] = tft_clip_y0;
+    con_clip[2] = tft_clip_x1;
+    con_clip[3] = tft_clip_y1;
+    tft_org_x = tft_org_y = 0;
+    tft_clip_x0 = tft_clip_y0 = 0;
+    tft_clip_x1 = _width;
+    tft_clip_y1 = _height;
+}
+
+static void tft_consoleRestore(void) {
+    tft_org_x = con_org_x;
+    tft_org_y = con_org_y;
+    tft_clip_x0 = con_clip[0];
+    tft_clip_y0 = con_clip[1];
+    tft_clip_x1 = con_clip[2];
+    tft_clip_y1 = con_clip[3];
+}
+
+// GRAM row of the top of the strip holding the current line
+static unsigned short tft_consoleRow(void) {
+    return con_top + (tft_console_lines % con_rows) * con_lh;
+}
+
+// erase whatever is left of older lines right of the current one
+static void tft_consoleClearRight(void) {
+    unsigned short strip = tft_console_lines % con_rows;
+
+    if (con_used[strip] > con_end) {
+        tft_consoleScreen();
+        tft_fillRect(con_end, tft_consoleRow(), con_used[strip] - con_end,
+                con_lh, con_bg);
+        tft_consoleRestore();
+        con_used[strip] = con_end;
+    }
+}
+
+static void tft_consoleNewline(void) {
+    tft_consoleClearRight();
+    con_col = con_end = 0;
+    tft_console_lines++;
+    if (tft_console_lines >= con_rows) {
+        // the strip of the oldest line becomes the bottom line
+        tft_console_scroll = con_top +
+            ((tft_console_lines + 1) % con_rows) * con_lh;
+        tft_scrollTo(tft_console_scroll);
+    }
+}
+
+char tft_consoleBegin(unsigned short top, unsigned short bottom,
+        unsigned char size, unsigned short color, unsigned short bg) {
+/* Turn the rows between the fixed areas into a scrolling console
+ * Parameters:
+ *      top:    rows kept fixed at the top of the screen
+ *      bottom: rows kept fixed at the bottom of the screen
+ *      size:   text size, 1 = 6x8 pixel characters
+ *      color:  text color
+ *      bg:     console background color
+ * Returns:     1, or 0 when not even one line fits between the fixed
+ *              areas: then nothing is set up and console output is dropped
+ * Note: the scroll area is cut down to whole lines, the spare rows go to
+ *      the bottom fixed area. The console area is cleared
+ */
+    unsigned short i;
+
+    // fixed areas no taller than the panel
+    if (top > ILI9340_TFTHEIGHT) top = ILI9340_TFTHEIGHT;
+    if (bottom > ILI9340_TFTHEIGHT - top) bottom = ILI9340_TFTHEIGHT - top;
+    con_size = size ? size : 1;
+    con_lh = 8 * con_size;
+    con_rows = (ILI9340_TFTHEIGHT - top - bottom) / con_lh;
+    if (!con_rows) return 0;
+    if (con_rows > TFT_CONSOLE_MAXROWS) con_rows = TFT_CONSOLE_MAXROWS;
+    con_cols = ILI9340_TFTWIDTH / (6 * con_size);
+    con_top = top;
+    con_color = color;
+    con_bg = bg;
+    con_col = con_end = 0;
+    con_esc = 0;
+    for (i = 0; i < con_rows; i++) con_used[i] = 0;
+    tft_console_lines = 0;
+    tft_console_scroll = top;
+
+    tft_scrollDefine(top, ILI9340_TFTHEIGHT - top - con_rows * con_lh);
+    tft_scrollTo(top);
+    tft_consoleScreen();
+    tft_fillRect(0, top, ILI9340_TFTWIDTH, con_rows * con_lh, bg);
+    tft_consoleRestore();
+    return 1;
+}
+
+void tft_consoleEnd(void) {
+/* Go back to an unscrolled screen
+ * Returns:     Nothing
+ * Note: the lines in the scroll area show up in GRAM order afterwards,
+ *      redraw or clear it
+ */
+    tft_scrollDefine(0, 0);
+    tft_scrollTo(0);
+}
+
+void tft_consolePutc(char c) {
+/* Write one character to the console
+ * Parameters:
+ *      c:  character; '\n' starts a new line, '\r' goes back to the start
+ *          of the line, long lines wrap
+ * Returns:     Nothing
+ */
+    unsigned short strip, x;
+
+    if (!con_rows) return;  // no console, see tft_consoleBegin()
+    if (con_esc) {
+        // ESC [ parameters end with a letter, other escapes are one char
+        if (con_esc == 1 && c == '[') con_esc = 2;
+        else if (con_esc == 1 || (c >= '@' && c <= '~')) con_esc = 0;
+        return;
+    }
+    if (c == 0x1b) {
+        con_esc = 1;
+        return;
+    }
+    if (c == '\n') {
+        tft_consoleNewline();
+        return;
+    }
+    if (c == '\r') {
+        con_col = 0;
+        return;
+    }
+    if (con_col >= con_cols) tft_consoleNewline();
+
+    strip = tft_console_lines % con_rows;
+    x = con_col * 6 * con_size;
+    tft_consoleScreen();
+    tft_drawChar(x, tft_consoleRow(), c, con_color, con_bg, con_size);
+    tft_consoleRestore();
+    con_col++;
+    if (con_end < x + 6 * con_size) con_end = x + 6 * con_size;
+    if (con_used[strip] < con_end) con_used[strip] = con_end;
+}
+
+void tft_consolePuts(const char *str) {
+/* Write a string to the console
+ * Parameters:
+ *      str:    null terminated string
+ * Returns:     Nothing
+ * Note: leftovers of older lines right of the current line are erased
+ *      at the end, so a recycled strip never shows them for long
+ */
+    if (!con_rows) return;
+    while (*str) tft_consolePutc(*str++);
+    tft_consoleClearRight();
+}
@@ -0,0 +1,48 @@
+/*
+ * File:   tft_console.h
+ * Scrolling text console on the ILI9340 hardware vertical scroll
+ *
+ * The rows between a fixed top and bottom area form a ring of text lines
+ * in GRAM. A new line is drawn into the strip of the oldest one and the
+ * panel's scroll start address (VSCRSADD) is moved on by one line, so
+ * nothing already on the screen is ever sent again: a full screen of
+ * scrolling text costs one line of SPI traffic per new line, instead of
+ * the repaint of every line that printLine() needs.
+ *
+ * Assumes tft_setRotation(0): the panel scrolls along GRAM rows, which
+ * are only screen rows in that orientation. Anything drawn into the
+ * scroll area outside the console scrolls along with it.
+ *
+ * The rows left between the fixed areas must hold at least one line,
+ * 8 * size rows; otherwise tft_consoleBegin() returns 0, sets nothing up
+ * and console output is dropped.
+ *
+ * Mirror the serial output of a thread with PT_SPAWN_CONSOLE() in place of
+ *      PT_SPAWN(pt, &pt_DMA_output, PT_DMA_PutSerialBuffer(&pt_DMA_output));
+ */
+
+#ifndef TFT_CONSOLE_H
+#define TFT_CONSOLE_H
+
+// most lines the scroll area can hold, 320 rows of size 1 text
+#define TFT_CONSOLE_MAXROWS (ILI9340_TFTHEIGHT / 8)
+
+char tft_consoleBegin(unsigned short top, unsigned short bottom,
+        unsigned char size, unsigned short color, unsigned short bg);
+void tft_consoleEnd(void);
+void tft_consolePutc(char c);
+void tft_consolePuts(const char *str);
+
+// lines written so far, and the GRAM row at the top of the scroll area
+unsigned long tft_console_lines;
+unsigned short tft_console_scroll;
+
+// write PT_send_buffer to the console, then spawn the DMA serial output
+// thread on it as usual (needs pt_cornell_1_3_2.h)
+#define PT_SPAWN_CONSOLE(pt, child) \
+    do { \
+        tft_consolePuts(PT_send_buffer); \
+        PT_SPAWN(pt, child, PT_DMA_PutSerialBuffer(child)); \
+    } while (0)
+
+#endif /* TFT_CONSOLE_H */
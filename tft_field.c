@@ -0,0 +1,123 @@
+/*
+ * File:   tft_field.c
+ * Text fields that only redraw the characters that changed, see
+ * tft_field.h
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include "plib.h"
+#include "tft_master.h"
+#include "tft_gfx.h"
+#include "tft_field.h"
+
+// draw text into the cells from cell i on, leaving the tft_gfx text
+// state (cursor, size, colors, wrap) as the caller had it
+static void tft_fieldDraw(struct tft_field *f, short i, char *text) {
+    unsigned short cx = cursor_x, cy = cursor_y, ts = textsize;
+    unsigned short tc = textcolor, tb = textbgcolor, wr = wrap;
+
+    tft_setTextColor2(f->color, f->bg);
+    tft_setTextSize(f->size);
+    tft_setTextWrap(0);
+    tft_setCursor(f->x + i * 6 * f->size, f->y);
+    tft_writeString(text);
+
+    cursor_x = cx;
+    cursor_y = cy;
+    textsize = ts;
+    textcolor = tc;
+    textbgcolor = tb;
+    wrap = wr;
+}
+
+void tft_fieldInit(struct tft_field *f, short x, short y, unsigned char cols,
+        unsigned char size) {
+/* Set up a field of cols character cells
+ * Parameters:
+ *      f:      the field
+ *      x, y:   top left of the first cell
+ *      cols:   cells, no more than TFT_FIELD_COLS; cut to fit the screen
+ *      size:   text size, as tft_setTextSize()
+ * Returns:     Nothing
+ * Note: draws nothing; the first print draws every cell
+ */
+    short fit = (_width - x) / (6 * size);
+
+    if (cols > TFT_FIELD_COLS) cols = TFT_FIELD_COLS;
+    if (cols > fit) cols = (fit > 0) ? fit : 0;
+    f->x = x;
+    f->y = y;
+    f->cols = cols;
+    f->size = size;
+    tft_fieldInvalidate(f);
+}
+
+void tft_fieldInvalidate(struct tft_field *f) {
+/* Forget what the field shows, so the next print draws all of it
+ * Parameters:
+ *      f:  the field
+ * Returns:     Nothing
+ */
+    unsigned char i;
+
+    for (i = 0; i < f->cols; i++) f->shown[i] = 0;
+}
+
+void tft_fieldPrint(struct tft_field *f, const char *s, unsigned short color,
+        unsigned short bg) {
+/* Show a string in the field
+ * Parameters:
+ *      f:      the field
+ *      s:      the text; blanks fill the rest of the field
+ *      color:  text color
+ *      bg:     background color, drawn behind every glyph
+ * Returns:     Nothing
+ * Note: only cells whose character changed are drawn, each run of them
+ *      as one string. New colors redraw the whole field. Tabs and
+ *      newlines are not for fields: they show as glyphs like any other
+ */
+    char run[TFT_FIELD_COLS + 1], c;
+    short i, n, start = 0;
+
+    if ((color != f->color) || (bg != f->bg)) {
+        tft_fieldInvalidate(f);
+        f->color = color;
+        f->bg = bg;
+    }
+    for (i = 0, n = 0; i <= f->cols; i++) {
+        c = ' ';
+        if ((i < f->cols) && *s) c = *s++;
+        // a run ends at the first unchanged cell, or at the end
+        if ((i < f->cols) && (c != f->shown[i])) {
+            if (!n) start = i;
+            run[n++] = c;
+            f->shown[i] = c;
+            continue;
+        }
+        if (i < f->cols) tft_field_kept++;
+        if (!n) continue;
+        run[n] = 0;
+        tft_fieldDraw(f, start, run);
+        tft_field_glyphs += n;
+        n = 0;
+    }
+}
+
+void tft_fieldPrintf(struct tft_field *f, unsigned short color,
+        unsigned short bg, const char *fmt, ...) {
+/* Show formatted text in the field, like sprintf() then tft_fieldPrint()
+ * Parameters:
+ *      f:          the field
+ *      color, bg:  text and background color
+ *      fmt, ...:   as printf()
+ * Returns:     Nothing
+ */
+    char buf[TFT_FIELD_COLS + 1];
+    va_list ap;
+
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    tft_fieldPrint(f, buf, color, bg);
+}
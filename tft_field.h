@@ -0,0 +1,48 @@
+/*
+ * File:   tft_field.h
+ * Text fields that only redraw the characters that changed
+ *
+ * printLine() erases its whole row and writes every character again, so
+ * a counter going from 41 to 42 costs a row of fill and all its glyphs.
+ * A field remembers what each of its character cells shows and redraws
+ * only the cells that differ, as opaque glyphs on the field background:
+ * no erase pass, and no flicker. Neighbouring changed cells go out as
+ * one string window (see TEXT_STRING in tft_gfx.h).
+ *
+ *      static struct tft_field time_field;
+ *      tft_fieldInit(&time_field, 0, 20, 19, 2);     // once
+ *      ...
+ *      tft_fieldPrintf(&time_field, ILI9340_YELLOW, ILI9340_BLACK,
+ *                      "Time=%d", sys_time_seconds);
+ * Text shorter than the field blanks the rest of it, longer text is cut.
+ * After something else drew over a field, tft_fieldInvalidate() makes
+ * the next print draw all of it.
+ */
+
+#ifndef TFT_FIELD_H
+#define TFT_FIELD_H
+
+// most character cells in a field: a size 1 line across the long side
+#ifndef TFT_FIELD_COLS
+#define TFT_FIELD_COLS  53
+#endif
+
+struct tft_field {
+    short x, y;                         // top left of the first cell
+    unsigned char cols, size;           // cells, text size
+    unsigned short color, bg;           // colors of what is shown
+    char shown[TFT_FIELD_COLS];         // character in each cell, 0: unknown
+};
+
+void tft_fieldInit(struct tft_field *f, short x, short y, unsigned char cols,
+        unsigned char size);
+void tft_fieldPrint(struct tft_field *f, const char *s, unsigned short color,
+        unsigned short bg);
+void tft_fieldPrintf(struct tft_field *f, unsigned short color,
+        unsigned short bg, const char *fmt, ...);
+void tft_fieldInvalidate(struct tft_field *f);
+
+// cells redrawn, and cells left alone because they showed the same
+unsigned long tft_field_glyphs, tft_field_kept;
+
+#endif /* TFT_FIELD_H */
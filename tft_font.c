@@ -0,0 +1,200 @@
+/*
+ * File:   tft_font.c
+ * Proportional and large fonts, see tft_font.h
+ *
+ * Every pixel is handled as a level 0..3 (1bpp fonts use 0 and 3), so
+ * both depths share one path: opaque text maps levels to four shades
+ * between bg and the text color, transparent text draws levels 2 and 3.
+ */
+
+#include "plib.h"
+#include "tft_master.h"
+#include "tft_font.h"
+
+// a glyph expanded to RGB565 for one color pair
+struct tft_font_slot {
+    const struct tft_font *f;       // NULL for an empty slot
+    unsigned char c;
+    unsigned short color, bg;
+    unsigned long used;             // font_clock when last drawn
+    unsigned short pix[TFT_FONT_SLOT];
+};
+
+static struct tft_font_slot font_cache[TFT_FONT_SLOTS];
+static unsigned long font_clock;
+static unsigned short font_shade[4];    // level 0..3 in the current colors
+static unsigned short shade_color, shade_bg;
+static char shade_valid;
+
+// the four levels between bg and color, worked out once per color pair
+static void tft_fontShades(unsigned short color, unsigned short bg) {
+    short l;
+    unsigned short r, g, b;
+
+    if (shade_valid && (color == shade_color) && (bg == shade_bg)) return;
+    for (l = 0; l < 4; l++) {
+        r = ((bg >> 11) * (3 - l) + (color >> 11) * l) / 3;
+        g = (((bg >> 5) & 0x3f) * (3 - l) + ((color >> 5) & 0x3f) * l) / 3;
+        b = ((bg & 0x1f) * (3 - l) + (color & 0x1f) * l) / 3;
+        font_shade[l] = (r << 11) | (g << 5) | b;
+    }
+    shade_color = color;
+    shade_bg = bg;
+    shade_valid = 1;
+}
+
+// level of pixel (i,j) of a glyph w wide starting at g
+static unsigned char tft_fontLevel(const struct tft_font *f,
+        const unsigned char *g, short w, short i, short j) {
+    const unsigned char *row = g + j * ((w * f->bpp + 7) / 8);
+
+    if (f->bpp == 1) return ((row[i >> 3] >> (~i & 7)) & 1) ? 3 : 0;
+    return (row[i >> 2] >> (6 - 2 * (i & 3))) & 3;
+}
+
+// the cache slot of glyph c in color/bg, decoded into it on a miss
+static struct tft_font_slot *tft_fontCached(const struct tft_font *f,
+        unsigned char c, unsigned short color, unsigned short bg) {
+    struct tft_font_slot *s, *old = font_cache;
+    const unsigned char *g = f->data + f->offset[c - f->first];
+    short w = f->width[c - f->first], i, j;
+    unsigned short *p;
+
+    font_clock++;
+    for (s = font_cache; s < font_cache + TFT_FONT_SLOTS; s++) {
+        if ((s->f == f) && (s->c == c) && (s->color == color) && (s->bg == bg)) {
+            s->used = font_clock;
+            tft_font_hits++;
+            return s;
+        }
+        if (s->used < old->used) old = s;
+    }
+    // least recently used slot
+    tft_font_misses++;
+    tft_fontShades(color, bg);
+    old->f = f;
+    old->c = c;
+    old->color = color;
+    old->bg = bg;
+    old->used = font_clock;
+    for (j = 0, p = old->pix; j < f->height; j++)
+        for (i = 0; i < w; i++) *p++ = font_shade[tft_fontLevel(f, g, w, i, j)];
+    return old;
+}
+
+short tft_fontDrawChar(short x, short y, unsigned char c,
+        const struct tft_font *f, unsigned short color, unsigned short bg) {
+/* Draw one glyph with its top left corner at (x,y)
+ * Parameters:
+ *      x, y:   top left corner, may be outside the clip rectangle
+ *      c:      character code
+ *      f:      the font
+ *      color:  text color
+ *      bg:     background color, or the same as color for transparent text
+ * Returns:     the glyph width, where the next glyph goes; 0 for a
+ *      character the font does not have
+ * Note: an opaque glyph fully inside the clip rectangle, no bigger than
+ *      TFT_FONT_SLOT pixels, goes out of the cache as one window. Anything
+ *      else is decoded as it is sent: cut to the clip rectangle, opaque
+ *      glyphs as one window of runs, transparent ones as a line per run
+ *      of set pixels
+ */
+    const unsigned char *g;
+    short w, h = f->height, i, j, a, x0, y0, cw, ch, gx, gy;
+    unsigned short run_color = 0, px;
+    unsigned long run = 0;
+    char clip;
+
+    if ((c < f->first) || (c > f->last)) return 0;
+    w = f->width[c - f->first];
+    g = f->data + f->offset[c - f->first];
+    x0 = x;
+    y0 = y;
+    cw = w;
+    ch = h;
+    clip = tft_clipRect(&x0, &y0, &cw, &ch);
+    if (clip == TFT_CLIP_OUT) return w;
+    // the visible part: glyph columns gx..gx+cw-1, rows gy..gy+ch-1
+    gx = x0 - tft_org_x - x;
+    gy = y0 - tft_org_y - y;
+
+    if (color == bg) {
+        for (j = gy; j < gy + ch; j++)
+            for (i = 0; i < w; ) {
+                if (tft_fontLevel(f, g, w, i, j) < 2) {
+                    i++;
+                    continue;
+                }
+                for (a = i; (i < w) && (tft_fontLevel(f, g, w, i, j) >= 2); i++) ;
+                tft_drawFastHLine(x + a, y + j, i - a, color);
+            }
+        return w;
+    }
+
+    if (!tft_fill_hook && (clip == TFT_CLIP_IN) && ((long)w * h <= TFT_FONT_SLOT)) {
+        struct tft_font_slot *s = tft_fontCached(f, c, color, bg);
+        tft_setAddrWindow(x0, y0, x0 + w - 1, y0 + h - 1);
+        tft_pushColors(s->pix, w * h);
+        return w;
+    }
+
+    tft_font_misses++;
+    tft_fontShades(color, bg);
+    if (tft_fill_hook) {
+        // tiles take rectangles, already clipped: one per run of a row
+        for (j = 0; j < ch; j++)
+            for (i = 0; i < cw; i = a) {
+                px = font_shade[tft_fontLevel(f, g, w, gx + i, gy + j)];
+                for (a = i + 1; (a < cw) &&
+                     (font_shade[tft_fontLevel(f, g, w, gx + a, gy + j)] == px); a++) ;
+                tft_fill_hook(x0 + i, y0 + j, a - i, 1, px);
+            }
+        return w;
+    }
+    tft_setAddrWindow(x0, y0, x0 + cw - 1, y0 + ch - 1);
+    for (j = gy; j < gy + ch; j++)
+        for (i = gx; i < gx + cw; i++) {
+            px = font_shade[tft_fontLevel(f, g, w, i, j)];
+            if ((px != run_color) && run) {
+                tft_pushRun(run_color, run);
+                run = 0;
+            }
+            run_color = px;
+            run++;
+        }
+    tft_pushRun(run_color, run);
+    return w;
+}
+
+short tft_fontDrawString(short x, short y, const char *s,
+        const struct tft_font *f, unsigned short color, unsigned short bg) {
+/* Draw a string on one line with its top left corner at (x,y)
+ * Parameters:
+ *      x, y:   top left corner
+ *      s:      the string
+ *      f:      the font
+ *      color:  text color
+ *      bg:     background color, or the same as color for transparent text
+ * Returns:     the width drawn
+ * Note: no wrapping, and control characters are glyphs like any other
+ */
+    short x0 = x;
+
+    while (*s) x += tft_fontDrawChar(x, y, *s++, f, color, bg);
+    return x - x0;
+}
+
+short tft_fontWidth(const char *s, const struct tft_font *f) {
+/* Width a string would take, e.g. to right align a readout
+ * Parameters:
+ *      s:  the string
+ *      f:  the font
+ * Returns:     the width in pixels
+ */
+    short w = 0;
+    unsigned char c;
+
+    while ((c = *s++))
+        if ((c >= f->first) && (c <= f->last)) w += f->width[c - f->first];
+    return w;
+}
@@ -0,0 +1,60 @@
+/*
+ * File:   tft_font.h
+ * Proportional and large fonts for the TFT
+ *
+ * tft_drawChar() scales the 5x7 font by repeating pixels, which makes
+ * big readouts blocky. A struct tft_font is a real font at its own size:
+ * every glyph as wide as it needs to be, 1 bit per pixel, or 2 bits for
+ * anti-aliased edges that fade from the text color into the background.
+ * host/fontc.c compiles one from a BDF font, or from glcdfont.c enlarged
+ * with smoothed diagonals; four of those come with the library.
+ *
+ * Opaque glyphs go out through a small cache in RAM: the last glyphs
+ * drawn, already expanded to RGB565 for their colors, each sent as one
+ * window from a single buffer. A readout that keeps printing the same
+ * digits decodes each of them once.
+ *
+ *      tft_fontDrawString(10, 100, "12.34 V", &tft_font24aa,
+ *                         ILI9340_YELLOW, ILI9340_BLACK);
+ * With color == bg the text is transparent: only the set pixels are
+ * drawn (anti-aliased edges then go to the text color or nothing).
+ */
+
+#ifndef TFT_FONT_H
+#define TFT_FONT_H
+
+// glyph cache: TFT_FONT_SLOTS glyphs of up to TFT_FONT_SLOT pixels each,
+// 2*TFT_FONT_SLOT*TFT_FONT_SLOTS bytes of RAM (about 10K as set here:
+// enough for the 13 glyphs of a "-12.34 V" readout in tft_font24aa).
+// Bigger glyphs are sent straight from the font; with small fonts only,
+// a smaller TFT_FONT_SLOT gives most of that RAM back
+#ifndef TFT_FONT_SLOTS
+#define TFT_FONT_SLOTS  12
+#endif
+#ifndef TFT_FONT_SLOT
+#define TFT_FONT_SLOT   432
+#endif
+
+struct tft_font {
+    unsigned char first, last;      // character codes it has
+    unsigned char height;           // rows of every glyph
+    unsigned char bpp;              // 1, or 2 for anti-aliased
+    const unsigned char *width;     // glyph widths, spacing included
+    const unsigned short *offset;   // where each glyph starts in data
+    const unsigned char *data;      // rows of (width*bpp+7)/8 bytes, msb left
+};
+
+// fonts that come with the library, made from glcdfont.c at 1x to 4x;
+// add the .c of the ones used to the project
+extern const struct tft_font tft_font8, tft_font16, tft_font24aa, tft_font32;
+
+short tft_fontDrawChar(short x, short y, unsigned char c,
+        const struct tft_font *f, unsigned short color, unsigned short bg);
+short tft_fontDrawString(short x, short y, const char *s,
+        const struct tft_font *f, unsigned short color, unsigned short bg);
+short tft_fontWidth(const char *s, const struct tft_font *f);
+
+// glyphs drawn from the cache, and glyphs decoded from the font
+unsigned long tft_font_hits, tft_font_misses;
+
+#endif /* TFT_FONT_H */
@@ -0,0 +1,1648 @@
+// glcdfont.c: ' ' to '~', 16 rows, 1bpp
+// glyphs trimmed to their ink and enlarged 2x
+// made by host/fontc.c, do not edit
+
+#include "tft_font.h"
+
+static const unsigned char tft_font16_width[95] = {
+    6, 4, 8, 12, 12, 12, 12, 8, 8, 8, 12, 12, 8, 12, 6, 12,
+    12, 8, 12, 12, 12, 12, 12, 12, 12, 12, 4, 6, 10, 12, 10, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 8, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 12, 10, 12, 12,
+    8, 12, 12, 12, 12, 12, 10, 12, 12, 8, 10, 10, 8, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 8, 4, 8, 12,
+};
+
+static const unsigned short tft_font16_offset[95] = {
+    0, 16, 32, 48, 80, 112, 144, 176, 192, 208, 224, 256,
+    288, 304, 336, 352, 384, 416, 432, 464, 496, 528, 560, 592,
+    624, 656, 688, 704, 720, 752, 784, 816, 848, 880, 912, 944,
+    976, 1008, 1040, 1072, 1104, 1136, 1152, 1184, 1216, 1248, 1280, 1312,
+    1344, 1376, 1408, 1440, 1472, 1504, 1536, 1568, 1600, 1632, 1664, 1696,
+    1728, 1760, 1792, 1824, 1856, 1872, 1904, 1936, 1968, 2000, 2032, 2064,
+    2096, 2128, 2144, 2176, 2208, 2224, 2256, 2288, 2320, 2352, 2384, 2416,
+    2448, 2480, 2512, 2544, 2576, 2608, 2640, 2672, 2688, 2704, 2720,
+};
+
+static const unsigned char tft_font16_data[2752] = {
+    // ' '
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '!'
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00,
+    // '"'
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0xcc,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '#'
+    0x33, 0x00,
+    0x33, 0x00,
+    0x33, 0x00,
+    0x73, 0x80,
+    0xff, 0xc0,
+    0xff, 0xc0,
+    0x33, 0x00,
+    0x33, 0x00,
+    0xff, 0xc0,
+    0xff, 0xc0,
+    0x73, 0x80,
+    0x33, 0x00,
+    0x33, 0x00,
+    0x33, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '$'
+    0x0c, 0x00,
+    0x1e, 0x00,
+    0x3f, 0xc0,
+    0x7f, 0xc0,
+    0xcc, 0x00,
+    0xcc, 0x00,
+    0x7f, 0x00,
+    0x3f, 0x80,
+    0x0c, 0xc0,
+    0x0c, 0xc0,
+    0xff, 0x80,
+    0xff, 0x00,
+    0x1e, 0x00,
+    0x0c, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '%'
+    0x60, 0x00,
+    0xf0, 0x00,
+    0xf0, 0xc0,
+    0x61, 0xc0,
+    0x03, 0x80,
+    0x07, 0x00,
+    0x0e, 0x00,
+    0x1c, 0x00,
+    0x38, 0x00,
+    0x70, 0x00,
+    0xe1, 0x80,
+    0xc3, 0xc0,
+    0x03, 0xc0,
+    0x01, 0x80,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '&'
+    0x30, 0x00,
+    0x78, 0x00,
+    0xcc, 0x00,
+    0xcc, 0x00,
+    0xcc, 0x00,
+    0xcc, 0x00,
+    0x30, 0x00,
+    0x30, 0x00,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xc3, 0x00,
+    0xe3, 0x00,
+    0x7c, 0xc0,
+    0x3c, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '''
+    0x18,
+    0x3c,
+    0x3c,
+    0x38,
+    0x38,
+    0x70,
+    0xe0,
+    0xc0,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '('
+    0x0c,
+    0x1c,
+    0x38,
+    0x70,
+    0xe0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xe0,
+    0x70,
+    0x38,
+    0x1c,
+    0x0c,
+    0x00,
+    0x00,
+    // ')'
+    0xc0,
+    0xe0,
+    0x70,
+    0x38,
+    0x1c,
+    0x0c,
+    0x0c,
+    0x0c,
+    0x0c,
+    0x1c,
+    0x38,
+    0x70,
+    0xe0,
+    0xc0,
+    0x00,
+    0x00,
+    // '*'
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0x1e, 0x00,
+    0x3f, 0x00,
+    0xff, 0xc0,
+    0xff, 0xc0,
+    0x3f, 0x00,
+    0x1e, 0x00,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '+'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x1e, 0x00,
+    0xff, 0xc0,
+    0xff, 0xc0,
+    0x1e, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // ','
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x18,
+    0x3c,
+    0x3c,
+    0x38,
+    0x38,
+    0x70,
+    0xe0,
+    0xc0,
+    // '-'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xff, 0xc0,
+    0xff, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '.'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x60,
+    0xf0,
+    0xf0,
+    0x60,
+    0x00,
+    0x00,
+    // '/'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0xc0,
+    0x01, 0xc0,
+    0x03, 0x80,
+    0x07, 0x00,
+    0x0e, 0x00,
+    0x1c, 0x00,
+    0x38, 0x00,
+    0x70, 0x00,
+    0xe0, 0x00,
+    0xc0, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '0'
+    0x3f, 0x00,
+    0x7f, 0x80,
+    0xe0, 0xc0,
+    0xc0, 0xc0,
+    0xc3, 0xc0,
+    0xc7, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xf8, 0xc0,
+    0xf0, 0xc0,
+    0xc0, 0xc0,
+    0xc1, 0xc0,
+    0x7f, 0x80,
+    0x3f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '1'
+    0x30,
+    0x70,
+    0xf0,
+    0xf0,
+    0x70,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x78,
+    0xfc,
+    0xfc,
+    0x00,
+    0x00,
+    // '2'
+    0x3f, 0x00,
+    0x7f, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0x00, 0xc0,
+    0x01, 0xc0,
+    0x3f, 0x80,
+    0x7f, 0x00,
+    0xe0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xe0, 0x00,
+    0xff, 0xc0,
+    0x7f, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '3'
+    0xff, 0x80,
+    0xff, 0xc0,
+    0x00, 0xc0,
+    0x00, 0xc0,
+    0x03, 0x80,
+    0x07, 0x00,
+    0x0f, 0x00,
+    0x0e, 0x80,
+    0x01, 0xc0,
+    0x00, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x7f, 0x80,
+    0x3f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '4'
+    0x03, 0x00,
+    0x07, 0x00,
+    0x0f, 0x00,
+    0x1f, 0x00,
+    0x33, 0x00,
+    0x73, 0x00,
+    0xc3, 0x00,
+    0xc7, 0x80,
+    0xff, 0xc0,
+    0x7f, 0xc0,
+    0x07, 0x80,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '5'
+    0x7f, 0xc0,
+    0xff, 0xc0,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xff, 0x00,
+    0x7f, 0x80,
+    0x01, 0xc0,
+    0x00, 0xc0,
+    0x00, 0xc0,
+    0x00, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x7f, 0x80,
+    0x3f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '6'
+    0x0f, 0xc0,
+    0x1f, 0xc0,
+    0x38, 0x00,
+    0x70, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xff, 0x00,
+    0xff, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x7f, 0x80,
+    0x3f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '7'
+    0xff, 0x80,
+    0xff, 0xc0,
+    0x01, 0xc0,
+    0x00, 0xc0,
+    0x00, 0xc0,
+    0x01, 0xc0,
+    0x03, 0x80,
+    0x07, 0x00,
+    0x0e, 0x00,
+    0x1c, 0x00,
+    0x38, 0x00,
+    0x70, 0x00,
+    0xe0, 0x00,
+    0xc0, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '8'
+    0x3f, 0x00,
+    0x7f, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x3f, 0x00,
+    0x3f, 0x00,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x7f, 0x80,
+    0x3f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '9'
+    0x3f, 0x00,
+    0x7f, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x7f, 0xc0,
+    0x3f, 0xc0,
+    0x00, 0xc0,
+    0x00, 0xc0,
+    0x03, 0x80,
+    0x07, 0x00,
+    0xfe, 0x00,
+    0xfc, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // ':'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // ';'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x30,
+    0x30,
+    0x00,
+    0x00,
+    0x30,
+    0x30,
+    0x30,
+    0x70,
+    0xe0,
+    0xc0,
+    0x00,
+    0x00,
+    // '<'
+    0x03, 0x00,
+    0x07, 0x00,
+    0x0e, 0x00,
+    0x1c, 0x00,
+    0x38, 0x00,
+    0x70, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0x70, 0x00,
+    0x38, 0x00,
+    0x1c, 0x00,
+    0x0e, 0x00,
+    0x07, 0x00,
+    0x03, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '='
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xff, 0xc0,
+    0xff, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xff, 0xc0,
+    0xff, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '>'
+    0xc0, 0x00,
+    0xe0, 0x00,
+    0x70, 0x00,
+    0x38, 0x00,
+    0x1c, 0x00,
+    0x0e, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x0e, 0x00,
+    0x1c, 0x00,
+    0x38, 0x00,
+    0x70, 0x00,
+    0xe0, 0x00,
+    0xc0, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '?'
+    0x3f, 0x00,
+    0x7f, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0x00, 0xc0,
+    0x01, 0xc0,
+    0x07, 0x80,
+    0x0f, 0x00,
+    0x0e, 0x00,
+    0x0c, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '@'
+    0x3f, 0x00,
+    0x7f, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcf, 0xc0,
+    0xcf, 0x80,
+    0xcf, 0x80,
+    0xc6, 0x00,
+    0xc0, 0x00,
+    0xe0, 0x00,
+    0x7f, 0xc0,
+    0x3f, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'A'
+    0x0c, 0x00,
+    0x1e, 0x00,
+    0x33, 0x00,
+    0x73, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0xff, 0xc0,
+    0xff, 0xc0,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'B'
+    0x7f, 0x00,
+    0xff, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0xff, 0x00,
+    0xff, 0x00,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0xff, 0x80,
+    0x7f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'C'
+    0x3f, 0x00,
+    0x7f, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x7f, 0x80,
+    0x3f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'D'
+    0x7f, 0x00,
+    0xff, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0xff, 0x80,
+    0x7f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'E'
+    0x7f, 0xc0,
+    0xff, 0xc0,
+    0xe0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xe0, 0x00,
+    0xff, 0x00,
+    0xff, 0x00,
+    0xe0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xe0, 0x00,
+    0xff, 0xc0,
+    0x7f, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'F'
+    0x7f, 0xc0,
+    0xff, 0xc0,
+    0xe0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xe0, 0x00,
+    0xff, 0x00,
+    0xff, 0x00,
+    0xe0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'G'
+    0x3f, 0x80,
+    0x7f, 0xc0,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc3, 0x80,
+    0xc3, 0xc0,
+    0xc0, 0xc0,
+    0xe0, 0xc0,
+    0x7f, 0xc0,
+    0x3f, 0x80,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'H'
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0xff, 0xc0,
+    0xff, 0xc0,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'I'
+    0xfc,
+    0xfc,
+    0x78,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x78,
+    0xfc,
+    0xfc,
+    0x00,
+    0x00,
+    // 'J'
+    0x0f, 0xc0,
+    0x0f, 0xc0,
+    0x07, 0x80,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0xc3, 0x00,
+    0xe7, 0x00,
+    0x7e, 0x00,
+    0x3c, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'K'
+    0xc0, 0xc0,
+    0xc1, 0xc0,
+    0xc3, 0x80,
+    0xc7, 0x00,
+    0xce, 0x00,
+    0xcc, 0x00,
+    0xf0, 0x00,
+    0xf0, 0x00,
+    0xcc, 0x00,
+    0xce, 0x00,
+    0xc7, 0x00,
+    0xc3, 0x80,
+    0xc1, 0xc0,
+    0xc0, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'L'
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xe0, 0x00,
+    0xff, 0xc0,
+    0x7f, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'M'
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0xf3, 0xc0,
+    0xf3, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'N'
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe0, 0xc0,
+    0xf0, 0xc0,
+    0xf8, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xc7, 0xc0,
+    0xc3, 0xc0,
+    0xc1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'O'
+    0x3f, 0x00,
+    0x7f, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x7f, 0x80,
+    0x3f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'P'
+    0x7f, 0x00,
+    0xff, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0xff, 0x80,
+    0xff, 0x00,
+    0xe0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'Q'
+    0x3f, 0x00,
+    0x7f, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xc3, 0x00,
+    0xe3, 0x00,
+    0x7c, 0xc0,
+    0x3c, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'R'
+    0x7f, 0x00,
+    0xff, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0xff, 0x80,
+    0xff, 0x00,
+    0xcc, 0x00,
+    0xcc, 0x00,
+    0xc7, 0x00,
+    0xc3, 0x80,
+    0xc1, 0xc0,
+    0xc0, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'S'
+    0x3f, 0x00,
+    0x7f, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0x00,
+    0xe0, 0x00,
+    0x7f, 0x00,
+    0x3f, 0x80,
+    0x01, 0xc0,
+    0x00, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x7f, 0x80,
+    0x3f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'T'
+    0x7f, 0x80,
+    0xff, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'U'
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x7f, 0x80,
+    0x3f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'V'
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x73, 0x80,
+    0x33, 0x00,
+    0x1e, 0x00,
+    0x0c, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'W'
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0x73, 0x80,
+    0x33, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'X'
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x73, 0x80,
+    0x33, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x33, 0x00,
+    0x73, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'Y'
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x73, 0x80,
+    0x33, 0x00,
+    0x1e, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'Z'
+    0xff, 0x80,
+    0xff, 0xc0,
+    0x00, 0xc0,
+    0x00, 0xc0,
+    0x03, 0x80,
+    0x07, 0x00,
+    0x1f, 0x00,
+    0x3e, 0x00,
+    0x38, 0x00,
+    0x70, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xff, 0xc0,
+    0x7f, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '['
+    0x7f, 0x00,
+    0xff, 0x00,
+    0xe0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xe0, 0x00,
+    0xff, 0x00,
+    0x7f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '\'
+    0x00, 0x00,
+    0x00, 0x00,
+    0xc0, 0x00,
+    0xe0, 0x00,
+    0x70, 0x00,
+    0x38, 0x00,
+    0x1c, 0x00,
+    0x0e, 0x00,
+    0x07, 0x00,
+    0x03, 0x80,
+    0x01, 0xc0,
+    0x00, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // ']'
+    0xfe, 0x00,
+    0xff, 0x00,
+    0x07, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x07, 0x00,
+    0xff, 0x00,
+    0xfe, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '^'
+    0x0c, 0x00,
+    0x1e, 0x00,
+    0x33, 0x00,
+    0x73, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '_'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xff, 0xc0,
+    0xff, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '`'
+    0x60,
+    0xf0,
+    0xf0,
+    0x70,
+    0x70,
+    0x38,
+    0x1c,
+    0x0c,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'a'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x3c, 0x00,
+    0x3e, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x3f, 0x00,
+    0x7f, 0x00,
+    0xc3, 0x00,
+    0xc3, 0x80,
+    0x7f, 0xc0,
+    0x3f, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'b'
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xcf, 0x00,
+    0xcf, 0x80,
+    0xf9, 0xc0,
+    0xf0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xf0, 0xc0,
+    0xf9, 0xc0,
+    0xcf, 0x80,
+    0xcf, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'c'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x3f, 0x00,
+    0x7f, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x7f, 0x80,
+    0x3f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'd'
+    0x00, 0xc0,
+    0x00, 0xc0,
+    0x00, 0xc0,
+    0x00, 0xc0,
+    0x3c, 0xc0,
+    0x7c, 0xc0,
+    0xe7, 0xc0,
+    0xc3, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc3, 0xc0,
+    0xe7, 0xc0,
+    0x7c, 0xc0,
+    0x3c, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'e'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x3f, 0x00,
+    0x7f, 0x80,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xff, 0xc0,
+    0xff, 0x80,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0x7f, 0x00,
+    0x3f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'f'
+    0x0c, 0x00,
+    0x1e, 0x00,
+    0x33, 0x00,
+    0x33, 0x00,
+    0x30, 0x00,
+    0x78, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0x78, 0x00,
+    0x30, 0x00,
+    0x30, 0x00,
+    0x30, 0x00,
+    0x30, 0x00,
+    0x30, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'g'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x3e, 0x00,
+    0x7f, 0x80,
+    0xe7, 0x80,
+    0xc3, 0xc0,
+    0xc3, 0xc0,
+    0xe5, 0xc0,
+    0x7c, 0xc0,
+    0x3c, 0xc0,
+    0x00, 0xc0,
+    0x01, 0xc0,
+    0x3f, 0x80,
+    0x3f, 0x00,
+    // 'h'
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xcf, 0x00,
+    0xcf, 0x80,
+    0xf9, 0xc0,
+    0xf0, 0xc0,
+    0xe0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'i'
+    0x30,
+    0x30,
+    0x00,
+    0x00,
+    0xe0,
+    0xf0,
+    0x70,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x78,
+    0xfc,
+    0xfc,
+    0x00,
+    0x00,
+    // 'j'
+    0x03, 0x00,
+    0x03, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0x03, 0x00,
+    0xc3, 0x00,
+    0xe7, 0x00,
+    0x7e, 0x00,
+    0x3c, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'k'
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc3, 0x00,
+    0xc7, 0x00,
+    0xce, 0x00,
+    0xcc, 0x00,
+    0xf0, 0x00,
+    0xf0, 0x00,
+    0xcc, 0x00,
+    0xce, 0x00,
+    0xc7, 0x00,
+    0xc3, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'l'
+    0xe0,
+    0xf0,
+    0x70,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x30,
+    0x78,
+    0xfc,
+    0xfc,
+    0x00,
+    0x00,
+    // 'm'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x73, 0x00,
+    0xf3, 0x80,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'n'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xcf, 0x00,
+    0xcf, 0x80,
+    0xf9, 0xc0,
+    0xf0, 0xc0,
+    0xe0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'o'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x3f, 0x00,
+    0x7f, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x7f, 0x80,
+    0x3f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'p'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xcf, 0x00,
+    0xcf, 0x80,
+    0xe9, 0xc0,
+    0xf0, 0xc0,
+    0xf0, 0xc0,
+    0xe9, 0xc0,
+    0xcf, 0x80,
+    0xcf, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    // 'q'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x3c, 0xc0,
+    0x7c, 0xc0,
+    0xe5, 0xc0,
+    0xc3, 0xc0,
+    0xc3, 0xc0,
+    0xe5, 0xc0,
+    0x7c, 0xc0,
+    0x3c, 0xc0,
+    0x00, 0xc0,
+    0x00, 0xc0,
+    0x00, 0xc0,
+    0x00, 0xc0,
+    // 'r'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xcf, 0x00,
+    0xcf, 0x80,
+    0xf9, 0xc0,
+    0xf0, 0xc0,
+    0xe0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 's'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x3f, 0xc0,
+    0x7f, 0xc0,
+    0xc0, 0x00,
+    0xc0, 0x00,
+    0x7f, 0x00,
+    0x3f, 0x80,
+    0x00, 0xc0,
+    0x00, 0xc0,
+    0xff, 0x80,
+    0xff, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 't'
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x1e, 0x00,
+    0xff, 0xc0,
+    0xff, 0xc0,
+    0x1e, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x0c, 0xc0,
+    0x0c, 0xc0,
+    0x07, 0x80,
+    0x03, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'u'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc1, 0xc0,
+    0xc3, 0xc0,
+    0xe7, 0xc0,
+    0x7c, 0xc0,
+    0x3c, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'v'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x73, 0x80,
+    0x33, 0x00,
+    0x1e, 0x00,
+    0x0c, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'w'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0x73, 0x80,
+    0x33, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'x'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x73, 0x80,
+    0x33, 0x00,
+    0x0c, 0x00,
+    0x0c, 0x00,
+    0x33, 0x00,
+    0x73, 0x80,
+    0xe1, 0xc0,
+    0xc0, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'y'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x7f, 0xc0,
+    0x3f, 0xc0,
+    0x01, 0xc0,
+    0x00, 0xc0,
+    0xc0, 0xc0,
+    0xe1, 0xc0,
+    0x7f, 0x80,
+    0x3f, 0x00,
+    // 'z'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xff, 0xc0,
+    0xff, 0xc0,
+    0x03, 0x80,
+    0x03, 0x00,
+    0x0e, 0x00,
+    0x1c, 0x00,
+    0x30, 0x00,
+    0x70, 0x00,
+    0xff, 0xc0,
+    0xff, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '{'
+    0x0c,
+    0x1c,
+    0x38,
+    0x30,
+    0x30,
+    0x70,
+    0xc0,
+    0xc0,
+    0x70,
+    0x30,
+    0x30,
+    0x38,
+    0x1c,
+    0x0c,
+    0x00,
+    0x00,
+    // '|'
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0xc0,
+    0x00,
+    0x00,
+    // '}'
+    0xc0,
+    0xe0,
+    0x70,
+    0x30,
+    0x30,
+    0x38,
+    0x0c,
+    0x0c,
+    0x38,
+    0x30,
+    0x30,
+    0x70,
+    0xe0,
+    0xc0,
+    0x00,
+    0x00,
+    // '~'
+    0x30, 0x00,
+    0x78, 0x00,
+    0xcc, 0xc0,
+    0xcc, 0xc0,
+    0x07, 0x80,
+    0x03, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+};
+
+const struct tft_font tft_font16 = {
+    32, 126, 16, 1,
+    tft_font16_width, tft_font16_offset, tft_font16_data
+};
@@ -0,0 +1,2408 @@
+// glcdfont.c: ' ' to '~', 24 rows, 2bpp anti-aliased
+// glyphs trimmed to their ink and enlarged 3x
+// made by host/fontc.c, do not edit
+
+#include "tft_font.h"
+
+static const unsigned char tft_font24aa_width[95] = {
+    9, 6, 12, 18, 18, 18, 18, 12, 12, 12, 18, 18, 12, 18, 9, 18,
+    18, 12, 18, 18, 18, 18, 18, 18, 18, 18, 6, 9, 15, 18, 15, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 12, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 15, 18, 15, 18, 18,
+    12, 18, 18, 18, 18, 18, 15, 18, 18, 12, 15, 15, 12, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 12, 6, 12, 18,
+};
+
+static const unsigned short tft_font24aa_offset[95] = {
+    0, 72, 120, 192, 312, 432, 552, 672, 744, 816, 888, 1008,
+    1128, 1200, 1320, 1392, 1512, 1632, 1704, 1824, 1944, 2064, 2184, 2304,
+    2424, 2544, 2664, 2712, 2784, 2880, 3000, 3096, 3216, 3336, 3456, 3576,
+    3696, 3816, 3936, 4056, 4176, 4296, 4368, 4488, 4608, 4728, 4848, 4968,
+    5088, 5208, 5328, 5448, 5568, 5688, 5808, 5928, 6048, 6168, 6288, 6408,
+    6504, 6624, 6720, 6840, 6960, 7032, 7152, 7272, 7392, 7512, 7632, 7728,
+    7848, 7968, 8040, 8136, 8232, 8304, 8424, 8544, 8664, 8784, 8904, 9024,
+    9144, 9264, 9384, 9504, 9624, 9744, 9864, 9984, 10056, 10104, 10176,
+};
+
+static const unsigned char tft_font24aa_data[10296] = {
+    // ' '
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '!'
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '"'
+    0xfc, 0x0f, 0xc0,
+    0xfc, 0x0f, 0xc0,
+    0xfc, 0x0f, 0xc0,
+    0xfc, 0x0f, 0xc0,
+    0xfc, 0x0f, 0xc0,
+    0xfc, 0x0f, 0xc0,
+    0xfc, 0x0f, 0xc0,
+    0xfc, 0x0f, 0xc0,
+    0xfc, 0x0f, 0xc0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '#'
+    0x03, 0xf0, 0x3f, 0x00, 0x00,
+    0x03, 0xf0, 0x3f, 0x00, 0x00,
+    0x03, 0xf0, 0x3f, 0x00, 0x00,
+    0x07, 0xf0, 0x3f, 0x40, 0x00,
+    0x0f, 0xf0, 0x3f, 0xc0, 0x00,
+    0x1f, 0xf4, 0x7f, 0xd0, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x07, 0xf4, 0x7f, 0x40, 0x00,
+    0x03, 0xf0, 0x3f, 0x00, 0x00,
+    0x07, 0xf4, 0x7f, 0x40, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x1f, 0xf4, 0x7f, 0xd0, 0x00,
+    0x0f, 0xf0, 0x3f, 0xc0, 0x00,
+    0x07, 0xf0, 0x3f, 0x40, 0x00,
+    0x03, 0xf0, 0x3f, 0x00, 0x00,
+    0x03, 0xf0, 0x3f, 0x00, 0x00,
+    0x03, 0xf0, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '$'
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x7f, 0xfd, 0x00, 0x00,
+    0x03, 0xff, 0xff, 0xfc, 0x00,
+    0x07, 0xff, 0xff, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0xfd, 0x1f, 0xd0, 0x00, 0x00,
+    0xfc, 0x0f, 0xc0, 0x00, 0x00,
+    0xfd, 0x1f, 0xd0, 0x00, 0x00,
+    0x1f, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0xd0, 0x00,
+    0x00, 0x1f, 0xd1, 0xfc, 0x00,
+    0x00, 0x0f, 0xc0, 0xfc, 0x00,
+    0x00, 0x1f, 0xd1, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xff, 0xff, 0x40, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00,
+    0x01, 0xff, 0xf4, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '%'
+    0x1f, 0x40, 0x00, 0x00, 0x00,
+    0x7f, 0xd0, 0x00, 0x00, 0x00,
+    0xff, 0xf0, 0x00, 0x00, 0x00,
+    0xff, 0xf0, 0x00, 0xfc, 0x00,
+    0x7f, 0xd0, 0x01, 0xfc, 0x00,
+    0x1f, 0x40, 0x07, 0xfc, 0x00,
+    0x00, 0x00, 0x3f, 0xd0, 0x00,
+    0x00, 0x00, 0x7f, 0x40, 0x00,
+    0x00, 0x01, 0xff, 0x00, 0x00,
+    0x00, 0x0f, 0xf4, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x7f, 0xc0, 0x00, 0x00,
+    0x03, 0xfd, 0x00, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00, 0x00,
+    0x1f, 0xf0, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x07, 0xd0, 0x00,
+    0xfd, 0x00, 0x1f, 0xf4, 0x00,
+    0xfc, 0x00, 0x3f, 0xfc, 0x00,
+    0x00, 0x00, 0x3f, 0xfc, 0x00,
+    0x00, 0x00, 0x1f, 0xf4, 0x00,
+    0x00, 0x00, 0x07, 0xd0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '&'
+    0x03, 0xf0, 0x00, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00, 0x00,
+    0x1f, 0xfd, 0x00, 0x00, 0x00,
+    0xfd, 0x1f, 0xc0, 0x00, 0x00,
+    0xfc, 0x0f, 0xc0, 0x00, 0x00,
+    0xfc, 0x0f, 0xc0, 0x00, 0x00,
+    0xfc, 0x0f, 0xc0, 0x00, 0x00,
+    0xfc, 0x0f, 0xc0, 0x00, 0x00,
+    0xfd, 0x1f, 0xc0, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00, 0x00,
+    0x03, 0xf0, 0x00, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00, 0x00,
+    0xfd, 0x1f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xd1, 0xfc, 0x00,
+    0xfd, 0x00, 0x7f, 0x40, 0x00,
+    0xff, 0x40, 0x3f, 0x00, 0x00,
+    0xff, 0xd0, 0x7f, 0x40, 0x00,
+    0x1f, 0xff, 0xd1, 0xfc, 0x00,
+    0x07, 0xff, 0xc0, 0xfc, 0x00,
+    0x03, 0xff, 0xc0, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '''
+    0x00, 0x7d, 0x00,
+    0x01, 0xff, 0x40,
+    0x03, 0xff, 0xc0,
+    0x03, 0xff, 0xc0,
+    0x03, 0xff, 0x40,
+    0x03, 0xff, 0x00,
+    0x07, 0xfd, 0x00,
+    0x0f, 0xf4, 0x00,
+    0x1f, 0xf0, 0x00,
+    0xff, 0x40, 0x00,
+    0xfd, 0x00, 0x00,
+    0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '('
+    0x00, 0x0f, 0xc0,
+    0x00, 0x1f, 0xc0,
+    0x00, 0x7f, 0xc0,
+    0x03, 0xfd, 0x00,
+    0x07, 0xf4, 0x00,
+    0x1f, 0xf0, 0x00,
+    0xff, 0x40, 0x00,
+    0xff, 0x00, 0x00,
+    0xfd, 0x00, 0x00,
+    0xfc, 0x00, 0x00,
+    0xfc, 0x00, 0x00,
+    0xfc, 0x00, 0x00,
+    0xfd, 0x00, 0x00,
+    0xff, 0x00, 0x00,
+    0xff, 0x40, 0x00,
+    0x1f, 0xf0, 0x00,
+    0x07, 0xf4, 0x00,
+    0x03, 0xfd, 0x00,
+    0x00, 0x7f, 0xc0,
+    0x00, 0x1f, 0xc0,
+    0x00, 0x0f, 0xc0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // ')'
+    0xfc, 0x00, 0x00,
+    0xfd, 0x00, 0x00,
+    0xff, 0x40, 0x00,
+    0x1f, 0xf0, 0x00,
+    0x07, 0xf4, 0x00,
+    0x03, 0xfd, 0x00,
+    0x00, 0x7f, 0xc0,
+    0x00, 0x3f, 0xc0,
+    0x00, 0x1f, 0xc0,
+    0x00, 0x0f, 0xc0,
+    0x00, 0x0f, 0xc0,
+    0x00, 0x0f, 0xc0,
+    0x00, 0x1f, 0xc0,
+    0x00, 0x3f, 0xc0,
+    0x00, 0x7f, 0xc0,
+    0x03, 0xfd, 0x00,
+    0x07, 0xf4, 0x00,
+    0x1f, 0xf0, 0x00,
+    0xff, 0x40, 0x00,
+    0xfd, 0x00, 0x00,
+    0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '*'
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x1f, 0xd0, 0xfc, 0x00,
+    0x01, 0xff, 0xfd, 0x00, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x01, 0xff, 0xfd, 0x00, 0x00,
+    0xfc, 0x1f, 0xd0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '+'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x7f, 0xf4, 0x00, 0x00,
+    0x01, 0xff, 0xfd, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x01, 0xff, 0xfd, 0x00, 0x00,
+    0x00, 0x7f, 0xf4, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // ','
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x7d, 0x00,
+    0x01, 0xff, 0x40,
+    0x03, 0xff, 0xc0,
+    0x03, 0xff, 0xc0,
+    0x03, 0xff, 0x40,
+    0x03, 0xff, 0x00,
+    0x07, 0xfd, 0x00,
+    0x0f, 0xf4, 0x00,
+    0x1f, 0xf0, 0x00,
+    0xff, 0x40, 0x00,
+    0xfd, 0x00, 0x00,
+    0xfc, 0x00, 0x00,
+    // '-'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '.'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x1f, 0x40, 0x00,
+    0x7f, 0xd0, 0x00,
+    0xff, 0xf0, 0x00,
+    0xff, 0xf0, 0x00,
+    0x7f, 0xd0, 0x00,
+    0x1f, 0x40, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '/'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x07, 0xfc, 0x00,
+    0x00, 0x00, 0x3f, 0xd0, 0x00,
+    0x00, 0x00, 0x7f, 0x40, 0x00,
+    0x00, 0x01, 0xff, 0x00, 0x00,
+    0x00, 0x0f, 0xf4, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x7f, 0xc0, 0x00, 0x00,
+    0x03, 0xfd, 0x00, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00, 0x00,
+    0x1f, 0xf0, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '0'
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x3f, 0xfc, 0x00,
+    0xfc, 0x00, 0x7f, 0xfc, 0x00,
+    0xfc, 0x01, 0xff, 0xfc, 0x00,
+    0xfc, 0x0f, 0xd1, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfd, 0x1f, 0xc0, 0xfc, 0x00,
+    0xff, 0xfd, 0x00, 0xfc, 0x00,
+    0xff, 0xf4, 0x00, 0xfc, 0x00,
+    0xff, 0xf0, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '1'
+    0x03, 0xf0, 0x00,
+    0x07, 0xf0, 0x00,
+    0x1f, 0xf0, 0x00,
+    0xff, 0xf0, 0x00,
+    0xff, 0xf0, 0x00,
+    0xff, 0xf0, 0x00,
+    0x1f, 0xf0, 0x00,
+    0x0f, 0xf0, 0x00,
+    0x07, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x07, 0xf4, 0x00,
+    0x0f, 0xfc, 0x00,
+    0x1f, 0xfd, 0x00,
+    0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xc0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '2'
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xfd, 0x00, 0x07, 0xfc, 0x00,
+    0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x07, 0xfc, 0x00,
+    0x00, 0x00, 0x1f, 0xfc, 0x00,
+    0x03, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xd0, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xff, 0xd0, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x7f, 0xff, 0xff, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '3'
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xff, 0xff, 0xf4, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x3f, 0xd0, 0x00,
+    0x00, 0x00, 0x7f, 0xc0, 0x00,
+    0x00, 0x01, 0xff, 0x40, 0x00,
+    0x00, 0x0f, 0xff, 0x40, 0x00,
+    0x00, 0x0f, 0xfc, 0xc0, 0x00,
+    0x00, 0x0f, 0xf1, 0xd0, 0x00,
+    0x00, 0x00, 0x1f, 0xfc, 0x00,
+    0x00, 0x00, 0x07, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '4'
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0x00, 0x00,
+    0x00, 0x0f, 0xff, 0x00, 0x00,
+    0x00, 0x1f, 0xff, 0x00, 0x00,
+    0x00, 0x7f, 0xff, 0x00, 0x00,
+    0x03, 0xf4, 0x7f, 0x00, 0x00,
+    0x07, 0xf0, 0x3f, 0x00, 0x00,
+    0x1f, 0xf0, 0x3f, 0x00, 0x00,
+    0xfd, 0x00, 0x7f, 0x40, 0x00,
+    0xfc, 0x01, 0xff, 0xc0, 0x00,
+    0xfd, 0x07, 0xff, 0xd0, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x7f, 0xff, 0xff, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x07, 0xff, 0xd0, 0x00,
+    0x00, 0x01, 0xff, 0xc0, 0x00,
+    0x00, 0x00, 0x7f, 0x40, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '5'
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0x7f, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00,
+    0x7f, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x00, 0x00, 0x1f, 0xfc, 0x00,
+    0x00, 0x00, 0x07, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '6'
+    0x00, 0x0f, 0xff, 0xfc, 0x00,
+    0x00, 0x1f, 0xff, 0xfc, 0x00,
+    0x00, 0x7f, 0xff, 0xfc, 0x00,
+    0x03, 0xff, 0x40, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00, 0x00,
+    0x1f, 0xf0, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x40, 0x00,
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '7'
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xff, 0xff, 0xf4, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x1f, 0xfc, 0x00,
+    0x00, 0x00, 0x07, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x03, 0xfc, 0x00,
+    0x00, 0x00, 0x07, 0xfc, 0x00,
+    0x00, 0x00, 0x3f, 0xd0, 0x00,
+    0x00, 0x00, 0x7f, 0x40, 0x00,
+    0x00, 0x01, 0xff, 0x00, 0x00,
+    0x00, 0x0f, 0xf4, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x7f, 0xc0, 0x00, 0x00,
+    0x03, 0xfd, 0x00, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00, 0x00,
+    0x1f, 0xf0, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '8'
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '9'
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0x07, 0xff, 0xff, 0xfc, 0x00,
+    0x03, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x3f, 0xd0, 0x00,
+    0x00, 0x00, 0x7f, 0x40, 0x00,
+    0x00, 0x07, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xf4, 0x00, 0x00,
+    0xff, 0xff, 0xd0, 0x00, 0x00,
+    0xff, 0xff, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // ':'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // ';'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x07, 0xf0, 0x00,
+    0x0f, 0xf0, 0x00,
+    0x1f, 0xf0, 0x00,
+    0xff, 0x40, 0x00,
+    0xfd, 0x00, 0x00,
+    0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '<'
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x01, 0xff, 0x00,
+    0x00, 0x0f, 0xf4, 0x00,
+    0x00, 0x1f, 0xd0, 0x00,
+    0x00, 0x7f, 0xc0, 0x00,
+    0x03, 0xfd, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00,
+    0x1f, 0xf0, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00,
+    0x1f, 0xf0, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00,
+    0x03, 0xfd, 0x00, 0x00,
+    0x00, 0x7f, 0xc0, 0x00,
+    0x00, 0x1f, 0xd0, 0x00,
+    0x00, 0x0f, 0xf4, 0x00,
+    0x00, 0x01, 0xff, 0x00,
+    0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // '='
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '>'
+    0xfc, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00,
+    0x1f, 0xf0, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00,
+    0x03, 0xfd, 0x00, 0x00,
+    0x00, 0x7f, 0xc0, 0x00,
+    0x00, 0x1f, 0xd0, 0x00,
+    0x00, 0x0f, 0xf4, 0x00,
+    0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x0f, 0xf4, 0x00,
+    0x00, 0x1f, 0xd0, 0x00,
+    0x00, 0x7f, 0xc0, 0x00,
+    0x03, 0xfd, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00,
+    0x1f, 0xf0, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // '?'
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xfd, 0x00, 0x07, 0xfc, 0x00,
+    0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x07, 0xfc, 0x00,
+    0x00, 0x00, 0x1f, 0xfc, 0x00,
+    0x00, 0x01, 0xff, 0xd0, 0x00,
+    0x00, 0x07, 0xff, 0x40, 0x00,
+    0x00, 0x0f, 0xff, 0x00, 0x00,
+    0x00, 0x0f, 0xf4, 0x00, 0x00,
+    0x00, 0x0f, 0xd0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '@'
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xd1, 0xfc, 0x00,
+    0xfc, 0x0f, 0xff, 0xfc, 0x00,
+    0xfc, 0x0f, 0xff, 0xf4, 0x00,
+    0xfc, 0x0f, 0xff, 0xf0, 0x00,
+    0xfc, 0x0f, 0xff, 0xd0, 0x00,
+    0xfc, 0x07, 0xff, 0x40, 0x00,
+    0xfc, 0x01, 0xf4, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xff, 0xd0, 0x00, 0x00, 0x00,
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0x07, 0xff, 0xff, 0xfc, 0x00,
+    0x03, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'A'
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x7f, 0xf4, 0x00, 0x00,
+    0x03, 0xf4, 0x7f, 0x00, 0x00,
+    0x07, 0xf0, 0x3f, 0x40, 0x00,
+    0x1f, 0xf0, 0x3f, 0xd0, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0x00, 0x03, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'B'
+    0x1f, 0xff, 0xff, 0x00, 0x00,
+    0x7f, 0xff, 0xff, 0x40, 0x00,
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0x40, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x40, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0x7f, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'C'
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0xfc, 0x00,
+    0xff, 0x40, 0x01, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'D'
+    0x1f, 0xff, 0xff, 0x00, 0x00,
+    0x7f, 0xff, 0xff, 0x40, 0x00,
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0x7f, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'E'
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0x7f, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xd0, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xff, 0xd0, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xd0, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xff, 0xd0, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x7f, 0xff, 0xff, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'F'
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0x7f, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xd0, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xff, 0xd0, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xd0, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'G'
+    0x03, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0xf4, 0x00,
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x3f, 0xd0, 0x00,
+    0xfc, 0x00, 0x3f, 0xf4, 0x00,
+    0xfc, 0x00, 0x3f, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x00, 0xfc, 0x00,
+    0xff, 0xd0, 0x01, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0x07, 0xff, 0xff, 0xf4, 0x00,
+    0x03, 0xff, 0xff, 0xd0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'H'
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'I'
+    0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xc0,
+    0x1f, 0xfd, 0x00,
+    0x0f, 0xfc, 0x00,
+    0x07, 0xf4, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x07, 0xf4, 0x00,
+    0x0f, 0xfc, 0x00,
+    0x1f, 0xfd, 0x00,
+    0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xc0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'J'
+    0x00, 0x0f, 0xff, 0xfc, 0x00,
+    0x00, 0x0f, 0xff, 0xfc, 0x00,
+    0x00, 0x0f, 0xff, 0xfc, 0x00,
+    0x00, 0x01, 0xff, 0xd0, 0x00,
+    0x00, 0x00, 0xff, 0xc0, 0x00,
+    0x00, 0x00, 0x7f, 0x40, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0xfc, 0x00, 0x7f, 0x00, 0x00,
+    0xfd, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xd7, 0xff, 0x00, 0x00,
+    0x1f, 0xff, 0xf4, 0x00, 0x00,
+    0x07, 0xff, 0xd0, 0x00, 0x00,
+    0x03, 0xff, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'K'
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x07, 0xfc, 0x00,
+    0xfc, 0x00, 0x3f, 0xd0, 0x00,
+    0xfc, 0x00, 0x7f, 0x40, 0x00,
+    0xfc, 0x01, 0xff, 0x00, 0x00,
+    0xfc, 0x0f, 0xf4, 0x00, 0x00,
+    0xfc, 0x0f, 0xd0, 0x00, 0x00,
+    0xfd, 0x1f, 0xc0, 0x00, 0x00,
+    0xff, 0xf4, 0x00, 0x00, 0x00,
+    0xff, 0xf0, 0x00, 0x00, 0x00,
+    0xff, 0xf4, 0x00, 0x00, 0x00,
+    0xfd, 0x1f, 0xc0, 0x00, 0x00,
+    0xfc, 0x0f, 0xd0, 0x00, 0x00,
+    0xfc, 0x0f, 0xf4, 0x00, 0x00,
+    0xfc, 0x01, 0xff, 0x00, 0x00,
+    0xfc, 0x00, 0x7f, 0x40, 0x00,
+    0xfc, 0x00, 0x3f, 0xd0, 0x00,
+    0xfc, 0x00, 0x07, 0xfc, 0x00,
+    0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'L'
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xff, 0xd0, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x7f, 0xff, 0xff, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'M'
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xf0, 0x3f, 0xfc, 0x00,
+    0xff, 0xf0, 0x3f, 0xfc, 0x00,
+    0xff, 0xf4, 0x7f, 0xfc, 0x00,
+    0xfd, 0x1f, 0xd1, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'N'
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x00, 0xfc, 0x00,
+    0xff, 0x00, 0x00, 0xfc, 0x00,
+    0xff, 0x40, 0x00, 0xfc, 0x00,
+    0xff, 0xf0, 0x00, 0xfc, 0x00,
+    0xff, 0xf4, 0x00, 0xfc, 0x00,
+    0xff, 0xfd, 0x00, 0xfc, 0x00,
+    0xfd, 0x1f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xd1, 0xfc, 0x00,
+    0xfc, 0x01, 0xff, 0xfc, 0x00,
+    0xfc, 0x00, 0x7f, 0xfc, 0x00,
+    0xfc, 0x00, 0x3f, 0xfc, 0x00,
+    0xfc, 0x00, 0x07, 0xfc, 0x00,
+    0xfc, 0x00, 0x03, 0xfc, 0x00,
+    0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'O'
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'P'
+    0x1f, 0xff, 0xff, 0x00, 0x00,
+    0x7f, 0xff, 0xff, 0x40, 0x00,
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xff, 0xff, 0x40, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xd0, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'Q'
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xd1, 0xfc, 0x00,
+    0xfd, 0x00, 0x7f, 0x40, 0x00,
+    0xff, 0x40, 0x3f, 0x00, 0x00,
+    0xff, 0xd0, 0x7f, 0x40, 0x00,
+    0x1f, 0xff, 0xd1, 0xfc, 0x00,
+    0x07, 0xff, 0xc0, 0xfc, 0x00,
+    0x03, 0xff, 0xc0, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'R'
+    0x1f, 0xff, 0xff, 0x00, 0x00,
+    0x7f, 0xff, 0xff, 0x40, 0x00,
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xff, 0xff, 0x40, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00,
+    0xfd, 0x1f, 0xd0, 0x00, 0x00,
+    0xfc, 0x0f, 0xc0, 0x00, 0x00,
+    0xfc, 0x0f, 0xd0, 0x00, 0x00,
+    0xfc, 0x01, 0xff, 0x00, 0x00,
+    0xfc, 0x00, 0x7f, 0x40, 0x00,
+    0xfc, 0x00, 0x3f, 0xd0, 0x00,
+    0xfc, 0x00, 0x07, 0xfc, 0x00,
+    0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'S'
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xff, 0xd0, 0x00, 0x00, 0x00,
+    0x1f, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0xd0, 0x00,
+    0x00, 0x00, 0x1f, 0xfc, 0x00,
+    0x00, 0x00, 0x07, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'T'
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x7f, 0xff, 0xff, 0xf4, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xfd, 0x1f, 0xd1, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'U'
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'V'
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x00, 0x03, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0x1f, 0xf0, 0x3f, 0xd0, 0x00,
+    0x07, 0xf0, 0x3f, 0x40, 0x00,
+    0x03, 0xf4, 0x7f, 0x00, 0x00,
+    0x00, 0x7f, 0xf4, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'W'
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfd, 0x1f, 0xd1, 0xfc, 0x00,
+    0x1f, 0xf4, 0x7f, 0xd0, 0x00,
+    0x07, 0xf0, 0x3f, 0x40, 0x00,
+    0x03, 0xf0, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'X'
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x00, 0x03, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0x1f, 0xf0, 0x3f, 0xd0, 0x00,
+    0x07, 0xf0, 0x3f, 0x40, 0x00,
+    0x03, 0xf4, 0x7f, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x03, 0xf4, 0x7f, 0x00, 0x00,
+    0x07, 0xf0, 0x3f, 0x40, 0x00,
+    0x1f, 0xf0, 0x3f, 0xd0, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0x00, 0x03, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'Y'
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x00, 0x03, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0x1f, 0xf0, 0x3f, 0xd0, 0x00,
+    0x07, 0xf0, 0x3f, 0x40, 0x00,
+    0x03, 0xf4, 0x7f, 0x00, 0x00,
+    0x00, 0x7f, 0xf4, 0x00, 0x00,
+    0x00, 0x3f, 0xf0, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'Z'
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xff, 0xff, 0xf4, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x3f, 0xd0, 0x00,
+    0x00, 0x00, 0x7f, 0xc0, 0x00,
+    0x00, 0x07, 0xff, 0x40, 0x00,
+    0x00, 0x7f, 0xff, 0x00, 0x00,
+    0x01, 0xff, 0xfd, 0x00, 0x00,
+    0x03, 0xff, 0xf4, 0x00, 0x00,
+    0x07, 0xff, 0x40, 0x00, 0x00,
+    0x0f, 0xf4, 0x00, 0x00, 0x00,
+    0x1f, 0xf0, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x7f, 0xff, 0xff, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '['
+    0x1f, 0xff, 0xff, 0x00,
+    0x7f, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00,
+    0xff, 0xd0, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00,
+    0xff, 0xd0, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x00,
+    0x7f, 0xff, 0xff, 0x00,
+    0x1f, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // '\'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0x1f, 0xf0, 0x00, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00, 0x00,
+    0x03, 0xfd, 0x00, 0x00, 0x00,
+    0x00, 0x7f, 0xc0, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x0f, 0xf4, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x7f, 0x40, 0x00,
+    0x00, 0x00, 0x3f, 0xd0, 0x00,
+    0x00, 0x00, 0x07, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // ']'
+    0xff, 0xff, 0xf4, 0x00,
+    0xff, 0xff, 0xfd, 0x00,
+    0xff, 0xff, 0xff, 0x00,
+    0x00, 0x07, 0xff, 0x00,
+    0x00, 0x01, 0xff, 0x00,
+    0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x01, 0xff, 0x00,
+    0x00, 0x07, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xfd, 0x00,
+    0xff, 0xff, 0xf4, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // '^'
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x7f, 0xf4, 0x00, 0x00,
+    0x03, 0xf4, 0x7f, 0x00, 0x00,
+    0x07, 0xf0, 0x3f, 0x40, 0x00,
+    0x1f, 0xf0, 0x3f, 0xd0, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '_'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '`'
+    0x1f, 0x40, 0x00,
+    0x7f, 0xd0, 0x00,
+    0xff, 0xf0, 0x00,
+    0xff, 0xf0, 0x00,
+    0x7f, 0xf0, 0x00,
+    0x3f, 0xf0, 0x00,
+    0x1f, 0xf4, 0x00,
+    0x07, 0xfc, 0x00,
+    0x03, 0xfd, 0x00,
+    0x00, 0x7f, 0xc0,
+    0x00, 0x1f, 0xc0,
+    0x00, 0x0f, 0xc0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'a'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xff, 0xc0, 0x00, 0x00,
+    0x03, 0xff, 0xd0, 0x00, 0x00,
+    0x03, 0xff, 0xf4, 0x00, 0x00,
+    0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x00, 0x00,
+    0x1f, 0xff, 0xff, 0x00, 0x00,
+    0xfd, 0x00, 0x7f, 0x40, 0x00,
+    0xfc, 0x00, 0x3f, 0xc0, 0x00,
+    0xfd, 0x00, 0x7f, 0xd0, 0x00,
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0x07, 0xff, 0xff, 0xfc, 0x00,
+    0x03, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'b'
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x0f, 0xff, 0x00, 0x00,
+    0xfc, 0x0f, 0xff, 0x40, 0x00,
+    0xfd, 0x1f, 0xff, 0xd0, 0x00,
+    0xff, 0xff, 0x5f, 0xfc, 0x00,
+    0xff, 0xf4, 0x07, 0xfc, 0x00,
+    0xff, 0xf0, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x00, 0xfc, 0x00,
+    0xff, 0xf0, 0x01, 0xfc, 0x00,
+    0xff, 0xf4, 0x07, 0xfc, 0x00,
+    0xff, 0xff, 0x5f, 0xfc, 0x00,
+    0xfd, 0x1f, 0xff, 0xd0, 0x00,
+    0xfc, 0x0f, 0xff, 0x40, 0x00,
+    0xfc, 0x0f, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'c'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0xfc, 0x00,
+    0xff, 0x40, 0x01, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'd'
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x03, 0xff, 0xc0, 0xfc, 0x00,
+    0x07, 0xff, 0xc0, 0xfc, 0x00,
+    0x1f, 0xff, 0xd1, 0xfc, 0x00,
+    0xff, 0xd7, 0xff, 0xfc, 0x00,
+    0xff, 0x40, 0x7f, 0xfc, 0x00,
+    0xfd, 0x00, 0x3f, 0xfc, 0x00,
+    0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x3f, 0xfc, 0x00,
+    0xff, 0x40, 0x7f, 0xfc, 0x00,
+    0xff, 0xd7, 0xff, 0xfc, 0x00,
+    0x1f, 0xff, 0xd1, 0xfc, 0x00,
+    0x07, 0xff, 0xc0, 0xfc, 0x00,
+    0x03, 0xff, 0xc0, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'e'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xf4, 0x00,
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0x1f, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x00, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'f'
+    0x00, 0x0f, 0xc0, 0x00,
+    0x00, 0x1f, 0xd0, 0x00,
+    0x00, 0x7f, 0xf4, 0x00,
+    0x03, 0xf4, 0x7f, 0x00,
+    0x03, 0xf0, 0x3f, 0x00,
+    0x03, 0xf0, 0x3f, 0x00,
+    0x07, 0xf4, 0x00, 0x00,
+    0x0f, 0xfc, 0x00, 0x00,
+    0x1f, 0xfd, 0x00, 0x00,
+    0xff, 0xff, 0xc0, 0x00,
+    0xff, 0xff, 0xc0, 0x00,
+    0xff, 0xff, 0xc0, 0x00,
+    0x1f, 0xfd, 0x00, 0x00,
+    0x0f, 0xfc, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00,
+    0x03, 0xf0, 0x00, 0x00,
+    0x03, 0xf0, 0x00, 0x00,
+    0x03, 0xf0, 0x00, 0x00,
+    0x03, 0xf0, 0x00, 0x00,
+    0x03, 0xf0, 0x00, 0x00,
+    0x03, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // 'g'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xff, 0xf4, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd7, 0xff, 0xf0, 0x00,
+    0xff, 0x41, 0xff, 0xf4, 0x00,
+    0xfd, 0x00, 0x7f, 0xfc, 0x00,
+    0xfd, 0x00, 0x7f, 0xfc, 0x00,
+    0xff, 0x41, 0xcf, 0xfc, 0x00,
+    0xff, 0xd7, 0xcf, 0xfc, 0x00,
+    0x1f, 0xff, 0xc1, 0xfc, 0x00,
+    0x07, 0xff, 0xc0, 0xfc, 0x00,
+    0x03, 0xff, 0xc0, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x07, 0xfc, 0x00,
+    0x00, 0x00, 0x1f, 0xfc, 0x00,
+    0x03, 0xff, 0xff, 0xd0, 0x00,
+    0x03, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    // 'h'
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x0f, 0xff, 0x00, 0x00,
+    0xfc, 0x0f, 0xff, 0x40, 0x00,
+    0xfd, 0x1f, 0xff, 0xd0, 0x00,
+    0xff, 0xff, 0x5f, 0xfc, 0x00,
+    0xff, 0xf4, 0x07, 0xfc, 0x00,
+    0xff, 0xf0, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x00, 0xfc, 0x00,
+    0xff, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'i'
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0xff, 0x40, 0x00,
+    0xff, 0xd0, 0x00,
+    0xff, 0xf0, 0x00,
+    0x1f, 0xf0, 0x00,
+    0x0f, 0xf0, 0x00,
+    0x07, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x07, 0xf4, 0x00,
+    0x0f, 0xfc, 0x00,
+    0x1f, 0xfd, 0x00,
+    0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xc0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'j'
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x3f, 0x00,
+    0xfc, 0x00, 0x7f, 0x00,
+    0xfd, 0x01, 0xff, 0x00,
+    0xff, 0xd7, 0xff, 0x00,
+    0x1f, 0xff, 0xf4, 0x00,
+    0x07, 0xff, 0xd0, 0x00,
+    0x03, 0xff, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // 'k'
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x3f, 0x00,
+    0xfc, 0x00, 0x7f, 0x00,
+    0xfc, 0x01, 0xff, 0x00,
+    0xfc, 0x0f, 0xf4, 0x00,
+    0xfc, 0x0f, 0xd0, 0x00,
+    0xfd, 0x1f, 0xc0, 0x00,
+    0xff, 0xf4, 0x00, 0x00,
+    0xff, 0xf0, 0x00, 0x00,
+    0xff, 0xf4, 0x00, 0x00,
+    0xfd, 0x1f, 0xc0, 0x00,
+    0xfc, 0x0f, 0xd0, 0x00,
+    0xfc, 0x0f, 0xf4, 0x00,
+    0xfc, 0x01, 0xff, 0x00,
+    0xfc, 0x00, 0x7f, 0x00,
+    0xfc, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // 'l'
+    0xff, 0x40, 0x00,
+    0xff, 0xd0, 0x00,
+    0xff, 0xf0, 0x00,
+    0x1f, 0xf0, 0x00,
+    0x0f, 0xf0, 0x00,
+    0x07, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x03, 0xf0, 0x00,
+    0x07, 0xf4, 0x00,
+    0x0f, 0xfc, 0x00,
+    0x1f, 0xfd, 0x00,
+    0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xc0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'm'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1f, 0xf0, 0x3f, 0x00, 0x00,
+    0x7f, 0xf0, 0x3f, 0x40, 0x00,
+    0xff, 0xf4, 0x7f, 0xd0, 0x00,
+    0xfd, 0x1f, 0xd1, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'n'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x0f, 0xff, 0x00, 0x00,
+    0xfc, 0x0f, 0xff, 0x40, 0x00,
+    0xfd, 0x1f, 0xff, 0xd0, 0x00,
+    0xff, 0xff, 0x5f, 0xfc, 0x00,
+    0xff, 0xf4, 0x07, 0xfc, 0x00,
+    0xff, 0xf0, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x00, 0xfc, 0x00,
+    0xff, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'o'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'p'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x0f, 0xff, 0x00, 0x00,
+    0xfc, 0x0f, 0xff, 0x40, 0x00,
+    0xfd, 0x0f, 0xff, 0xd0, 0x00,
+    0xff, 0xcf, 0x5f, 0xfc, 0x00,
+    0xff, 0xcd, 0x07, 0xfc, 0x00,
+    0xff, 0xf4, 0x01, 0xfc, 0x00,
+    0xff, 0xf4, 0x01, 0xfc, 0x00,
+    0xff, 0xcd, 0x07, 0xfc, 0x00,
+    0xff, 0xcf, 0x5f, 0xfc, 0x00,
+    0xfd, 0x0f, 0xff, 0xd0, 0x00,
+    0xfc, 0x0f, 0xff, 0x40, 0x00,
+    0xfc, 0x0f, 0xff, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    // 'q'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xff, 0xc0, 0xfc, 0x00,
+    0x07, 0xff, 0xc0, 0xfc, 0x00,
+    0x1f, 0xff, 0xc1, 0xfc, 0x00,
+    0xff, 0xd7, 0xcf, 0xfc, 0x00,
+    0xff, 0x41, 0xcf, 0xfc, 0x00,
+    0xfd, 0x00, 0x7f, 0xfc, 0x00,
+    0xfd, 0x00, 0x7f, 0xfc, 0x00,
+    0xff, 0x41, 0xcf, 0xfc, 0x00,
+    0xff, 0xd7, 0xcf, 0xfc, 0x00,
+    0x1f, 0xff, 0xc1, 0xfc, 0x00,
+    0x07, 0xff, 0xc0, 0xfc, 0x00,
+    0x03, 0xff, 0xc0, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    // 'r'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x0f, 0xff, 0x00, 0x00,
+    0xfc, 0x0f, 0xff, 0x40, 0x00,
+    0xfd, 0x1f, 0xff, 0xd0, 0x00,
+    0xff, 0xff, 0x5f, 0xfc, 0x00,
+    0xff, 0xf4, 0x01, 0xfc, 0x00,
+    0xff, 0xf0, 0x00, 0xfc, 0x00,
+    0xff, 0x40, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 's'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xff, 0xff, 0xfc, 0x00,
+    0x07, 0xff, 0xff, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00,
+    0x1f, 0xff, 0xff, 0x00, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0xd0, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xd0, 0x00,
+    0xff, 0xff, 0xff, 0x40, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 't'
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x7f, 0xf4, 0x00, 0x00,
+    0x01, 0xff, 0xfd, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x01, 0xff, 0xfd, 0x00, 0x00,
+    0x00, 0x7f, 0xf4, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0xfc, 0x00,
+    0x00, 0x0f, 0xc0, 0xfc, 0x00,
+    0x00, 0x0f, 0xd1, 0xfc, 0x00,
+    0x00, 0x01, 0xff, 0xd0, 0x00,
+    0x00, 0x00, 0x7f, 0x40, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'u'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x03, 0xfc, 0x00,
+    0xfc, 0x00, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x3f, 0xfc, 0x00,
+    0xff, 0x40, 0x7f, 0xfc, 0x00,
+    0xff, 0xd7, 0xff, 0xfc, 0x00,
+    0x1f, 0xff, 0xd1, 0xfc, 0x00,
+    0x07, 0xff, 0xc0, 0xfc, 0x00,
+    0x03, 0xff, 0xc0, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'v'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x00, 0x03, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0x1f, 0xf0, 0x3f, 0xd0, 0x00,
+    0x07, 0xf0, 0x3f, 0x40, 0x00,
+    0x03, 0xf4, 0x7f, 0x00, 0x00,
+    0x00, 0x7f, 0xf4, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'w'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfd, 0x1f, 0xd1, 0xfc, 0x00,
+    0x1f, 0xf4, 0x7f, 0xd0, 0x00,
+    0x07, 0xf0, 0x3f, 0x40, 0x00,
+    0x03, 0xf0, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'x'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0x1f, 0xf0, 0x3f, 0xd0, 0x00,
+    0x07, 0xf0, 0x3f, 0x40, 0x00,
+    0x03, 0xf4, 0x7f, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x03, 0xf4, 0x7f, 0x00, 0x00,
+    0x07, 0xf0, 0x3f, 0x40, 0x00,
+    0x1f, 0xf0, 0x3f, 0xd0, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 'y'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0xfd, 0x00, 0x01, 0xfc, 0x00,
+    0xff, 0x40, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xfc, 0x00,
+    0x07, 0xff, 0xff, 0xfc, 0x00,
+    0x03, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x1f, 0xfc, 0x00,
+    0x00, 0x00, 0x07, 0xfc, 0x00,
+    0x00, 0x00, 0x01, 0xfc, 0x00,
+    0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0xfd, 0x00, 0x07, 0xfc, 0x00,
+    0xff, 0xd0, 0x1f, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0xd0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x00,
+    0x03, 0xff, 0xff, 0x00, 0x00,
+    // 'z'
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x7f, 0xd0, 0x00,
+    0x00, 0x00, 0x3f, 0x40, 0x00,
+    0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x00, 0x0f, 0xf4, 0x00, 0x00,
+    0x00, 0x1f, 0xd0, 0x00, 0x00,
+    0x00, 0x7f, 0xc0, 0x00, 0x00,
+    0x03, 0xf4, 0x00, 0x00, 0x00,
+    0x07, 0xf0, 0x00, 0x00, 0x00,
+    0x1f, 0xf4, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0xff, 0xff, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // '{'
+    0x00, 0x0f, 0xc0,
+    0x00, 0x1f, 0xc0,
+    0x00, 0x7f, 0xc0,
+    0x03, 0xfd, 0x00,
+    0x03, 0xfc, 0x00,
+    0x03, 0xf4, 0x00,
+    0x07, 0xf0, 0x00,
+    0x0f, 0xf0, 0x00,
+    0x1f, 0xf0, 0x00,
+    0xfd, 0x00, 0x00,
+    0xfc, 0x00, 0x00,
+    0xfd, 0x00, 0x00,
+    0x1f, 0xf0, 0x00,
+    0x0f, 0xf0, 0x00,
+    0x07, 0xf0, 0x00,
+    0x03, 0xf4, 0x00,
+    0x03, 0xfc, 0x00,
+    0x03, 0xfd, 0x00,
+    0x00, 0x7f, 0xc0,
+    0x00, 0x1f, 0xc0,
+    0x00, 0x0f, 0xc0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '|'
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0xfc, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '}'
+    0xfc, 0x00, 0x00,
+    0xfd, 0x00, 0x00,
+    0xff, 0x40, 0x00,
+    0x1f, 0xf0, 0x00,
+    0x0f, 0xf0, 0x00,
+    0x07, 0xf0, 0x00,
+    0x03, 0xf4, 0x00,
+    0x03, 0xfc, 0x00,
+    0x03, 0xfd, 0x00,
+    0x00, 0x1f, 0xc0,
+    0x00, 0x0f, 0xc0,
+    0x00, 0x1f, 0xc0,
+    0x03, 0xfd, 0x00,
+    0x03, 0xfc, 0x00,
+    0x03, 0xf4, 0x00,
+    0x07, 0xf0, 0x00,
+    0x0f, 0xf0, 0x00,
+    0x1f, 0xf0, 0x00,
+    0xff, 0x40, 0x00,
+    0xfd, 0x00, 0x00,
+    0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '~'
+    0x03, 0xf0, 0x00, 0x00, 0x00,
+    0x07, 0xf4, 0x00, 0x00, 0x00,
+    0x1f, 0xfd, 0x00, 0x00, 0x00,
+    0xfd, 0x1f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xc0, 0xfc, 0x00,
+    0xfc, 0x0f, 0xd1, 0xfc, 0x00,
+    0x00, 0x01, 0xff, 0xd0, 0x00,
+    0x00, 0x00, 0x7f, 0x40, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const struct tft_font tft_font24aa = {
+    32, 126, 24, 2,
+    tft_font24aa_width, tft_font24aa_offset, tft_font24aa_data
+};
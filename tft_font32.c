@@ -0,0 +1,3168 @@
+// glcdfont.c: ' ' to '~', 32 rows, 1bpp
+// glyphs trimmed to their ink and enlarged 4x
+// made by host/fontc.c, do not edit
+
+#include "tft_font.h"
+
+static const unsigned char tft_font32_width[95] = {
+    12, 8, 16, 24, 24, 24, 24, 16, 16, 16, 24, 24, 16, 24, 12, 24,
+    24, 16, 24, 24, 24, 24, 24, 24, 24, 24, 8, 12, 20, 24, 20, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 16, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 20, 24, 20, 24, 24,
+    16, 24, 24, 24, 24, 24, 20, 24, 24, 16, 20, 20, 16, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 16, 8, 16, 24,
+};
+
+static const unsigned short tft_font32_offset[95] = {
+    0, 64, 96, 160, 256, 352, 448, 544, 608, 672, 736, 832,
+    928, 992, 1088, 1152, 1248, 1344, 1408, 1504, 1600, 1696, 1792, 1888,
+    1984, 2080, 2176, 2208, 2272, 2368, 2464, 2560, 2656, 2752, 2848, 2944,
+    3040, 3136, 3232, 3328, 3424, 3520, 3584, 3680, 3776, 3872, 3968, 4064,
+    4160, 4256, 4352, 4448, 4544, 4640, 4736, 4832, 4928, 5024, 5120, 5216,
+    5312, 5408, 5504, 5600, 5696, 5760, 5856, 5952, 6048, 6144, 6240, 6336,
+    6432, 6528, 6592, 6688, 6784, 6848, 6944, 7040, 7136, 7232, 7328, 7424,
+    7520, 7616, 7712, 7808, 7904, 8000, 8096, 8192, 8256, 8288, 8352,
+};
+
+static const unsigned char tft_font32_data[8448] = {
+    // ' '
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '!'
+    0x60,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0x60,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x60,
+    0xf0,
+    0xf0,
+    0x60,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '"'
+    0x60, 0x60,
+    0xf0, 0xf0,
+    0xf0, 0xf0,
+    0xf0, 0xf0,
+    0xf0, 0xf0,
+    0xf0, 0xf0,
+    0xf0, 0xf0,
+    0xf0, 0xf0,
+    0xf0, 0xf0,
+    0xf0, 0xf0,
+    0xf0, 0xf0,
+    0x60, 0x60,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '#'
+    0x06, 0x06, 0x00,
+    0x0f, 0x0f, 0x00,
+    0x0f, 0x0f, 0x00,
+    0x0f, 0x0f, 0x00,
+    0x0f, 0x0f, 0x00,
+    0x1f, 0x0f, 0x80,
+    0x1f, 0x0f, 0x80,
+    0x7f, 0x9f, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0x9f, 0x80,
+    0x0f, 0x0f, 0x00,
+    0x0f, 0x0f, 0x00,
+    0x1f, 0x9f, 0x80,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xe0,
+    0x7f, 0x9f, 0xe0,
+    0x1f, 0x0f, 0x80,
+    0x1f, 0x0f, 0x80,
+    0x0f, 0x0f, 0x00,
+    0x0f, 0x0f, 0x00,
+    0x0f, 0x0f, 0x00,
+    0x0f, 0x0f, 0x00,
+    0x06, 0x06, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '$'
+    0x00, 0x60, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x07, 0xfe, 0x00,
+    0x07, 0xff, 0xe0,
+    0x1f, 0xff, 0xf0,
+    0x1f, 0xff, 0xf0,
+    0x7f, 0xff, 0xe0,
+    0x79, 0xf8, 0x00,
+    0xf0, 0xf0, 0x00,
+    0xf0, 0xf0, 0x00,
+    0x79, 0xf8, 0x00,
+    0x7f, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xff, 0xe0,
+    0x01, 0xf9, 0xe0,
+    0x00, 0xf0, 0xf0,
+    0x00, 0xf0, 0xf0,
+    0x01, 0xf9, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0x80,
+    0xff, 0xff, 0x80,
+    0x7f, 0xfe, 0x00,
+    0x07, 0xfe, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '%'
+    0x18, 0x00, 0x00,
+    0x7e, 0x00, 0x00,
+    0x7e, 0x00, 0x00,
+    0xff, 0x00, 0x00,
+    0xff, 0x00, 0x60,
+    0x7e, 0x01, 0xf0,
+    0x7e, 0x01, 0xf0,
+    0x18, 0x07, 0xe0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x1f, 0x80,
+    0x00, 0x1f, 0x80,
+    0x00, 0x7e, 0x00,
+    0x00, 0x7e, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x07, 0xe0, 0x00,
+    0x07, 0xe0, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x7e, 0x00, 0x00,
+    0x7e, 0x01, 0x80,
+    0xf8, 0x07, 0xe0,
+    0xf8, 0x07, 0xe0,
+    0x60, 0x0f, 0xf0,
+    0x00, 0x0f, 0xf0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x01, 0x80,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '&'
+    0x06, 0x00, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x7f, 0xe0, 0x00,
+    0x79, 0xe0, 0x00,
+    0xf0, 0xf0, 0x00,
+    0xf0, 0xf0, 0x00,
+    0xf0, 0xf0, 0x00,
+    0xf0, 0xf0, 0x00,
+    0xf0, 0xf0, 0x00,
+    0xf0, 0xf0, 0x00,
+    0x69, 0x60, 0x00,
+    0x16, 0x80, 0x00,
+    0x0f, 0x00, 0x00,
+    0x0f, 0x00, 0x00,
+    0x16, 0x80, 0x00,
+    0x69, 0x60, 0x60,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0x69, 0x60,
+    0xf0, 0x16, 0x80,
+    0xf8, 0x0f, 0x00,
+    0xf8, 0x0f, 0x00,
+    0x7e, 0x16, 0x80,
+    0x7f, 0xe9, 0x60,
+    0x1f, 0xf0, 0xf0,
+    0x1f, 0xf0, 0xf0,
+    0x07, 0xe0, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '''
+    0x01, 0x80,
+    0x07, 0xe0,
+    0x07, 0xe0,
+    0x0f, 0xf0,
+    0x0f, 0xf0,
+    0x0f, 0xe0,
+    0x0f, 0xe0,
+    0x0f, 0xc0,
+    0x0f, 0xc0,
+    0x1f, 0x80,
+    0x1f, 0x80,
+    0x7e, 0x00,
+    0x7e, 0x00,
+    0xf8, 0x00,
+    0xf8, 0x00,
+    0x60, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '('
+    0x00, 0x60,
+    0x01, 0xf0,
+    0x01, 0xf0,
+    0x07, 0xe0,
+    0x07, 0xe0,
+    0x1f, 0x80,
+    0x1f, 0x80,
+    0x7e, 0x00,
+    0x7e, 0x00,
+    0xf8, 0x00,
+    0xf8, 0x00,
+    0xf0, 0x00,
+    0xf0, 0x00,
+    0xf0, 0x00,
+    0xf0, 0x00,
+    0xf0, 0x00,
+    0xf0, 0x00,
+    0xf8, 0x00,
+    0xf8, 0x00,
+    0x7e, 0x00,
+    0x7e, 0x00,
+    0x1f, 0x80,
+    0x1f, 0x80,
+    0x07, 0xe0,
+    0x07, 0xe0,
+    0x01, 0xf0,
+    0x01, 0xf0,
+    0x00, 0x60,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // ')'
+    0x60, 0x00,
+    0xf8, 0x00,
+    0xf8, 0x00,
+    0x7e, 0x00,
+    0x7e, 0x00,
+    0x1f, 0x80,
+    0x1f, 0x80,
+    0x07, 0xe0,
+    0x07, 0xe0,
+    0x01, 0xf0,
+    0x01, 0xf0,
+    0x00, 0xf0,
+    0x00, 0xf0,
+    0x00, 0xf0,
+    0x00, 0xf0,
+    0x00, 0xf0,
+    0x00, 0xf0,
+    0x01, 0xf0,
+    0x01, 0xf0,
+    0x07, 0xe0,
+    0x07, 0xe0,
+    0x1f, 0x80,
+    0x1f, 0x80,
+    0x7e, 0x00,
+    0x7e, 0x00,
+    0xf8, 0x00,
+    0xf8, 0x00,
+    0x60, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '*'
+    0x00, 0x60, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x60, 0xf0, 0x60,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0x61, 0xf8, 0x60,
+    0x01, 0xf8, 0x00,
+    0x07, 0xfe, 0x00,
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    0x07, 0xfe, 0x00,
+    0x01, 0xf8, 0x00,
+    0x61, 0xf8, 0x60,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0x60, 0xf0, 0x60,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '+'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x60, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x07, 0xfe, 0x00,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xe0,
+    0x07, 0xfe, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // ','
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x01, 0x80,
+    0x07, 0xe0,
+    0x07, 0xe0,
+    0x0f, 0xf0,
+    0x0f, 0xf0,
+    0x0f, 0xe0,
+    0x0f, 0xe0,
+    0x0f, 0xc0,
+    0x0f, 0xc0,
+    0x1f, 0x80,
+    0x1f, 0x80,
+    0x7e, 0x00,
+    0x7e, 0x00,
+    0xf8, 0x00,
+    0xf8, 0x00,
+    0x60, 0x00,
+    // '-'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xe0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '.'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x18, 0x00,
+    0x7e, 0x00,
+    0x7e, 0x00,
+    0xff, 0x00,
+    0xff, 0x00,
+    0x7e, 0x00,
+    0x7e, 0x00,
+    0x18, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '/'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60,
+    0x00, 0x01, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x1f, 0x80,
+    0x00, 0x1f, 0x80,
+    0x00, 0x7e, 0x00,
+    0x00, 0x7e, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x07, 0xe0, 0x00,
+    0x07, 0xe0, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x7e, 0x00, 0x00,
+    0x7e, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '0'
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x7e, 0x01, 0xe0,
+    0xf8, 0x00, 0xf0,
+    0xf8, 0x00, 0xf0,
+    0xf0, 0x01, 0xf0,
+    0xf0, 0x07, 0xf0,
+    0xf0, 0x1f, 0xf0,
+    0xf0, 0x1f, 0xf0,
+    0xf0, 0x7f, 0xf0,
+    0xf0, 0x79, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf9, 0xe0, 0xf0,
+    0xff, 0xe0, 0xf0,
+    0xff, 0x80, 0xf0,
+    0xff, 0x80, 0xf0,
+    0xfe, 0x00, 0xf0,
+    0xf8, 0x00, 0xf0,
+    0xf0, 0x01, 0xf0,
+    0xf0, 0x01, 0xf0,
+    0x78, 0x07, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '1'
+    0x06, 0x00,
+    0x1f, 0x00,
+    0x1f, 0x00,
+    0x7f, 0x00,
+    0x7f, 0x00,
+    0xff, 0x00,
+    0xff, 0x00,
+    0x7f, 0x00,
+    0x7f, 0x00,
+    0x1f, 0x00,
+    0x1f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x1f, 0x80,
+    0x1f, 0x80,
+    0x7f, 0xe0,
+    0x7f, 0xe0,
+    0xff, 0xf0,
+    0xff, 0xf0,
+    0x7f, 0xe0,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '2'
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x60, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x07, 0xe0,
+    0x07, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xfe, 0x00,
+    0x7e, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xfe, 0x00, 0x00,
+    0xff, 0xff, 0xe0,
+    0x7f, 0xff, 0xf0,
+    0x7f, 0xff, 0xf0,
+    0x1f, 0xff, 0xe0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '3'
+    0x7f, 0xff, 0x80,
+    0xff, 0xff, 0xe0,
+    0xff, 0xff, 0xe0,
+    0x7f, 0xff, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x01, 0xe0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x1f, 0x80,
+    0x00, 0x1f, 0x80,
+    0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00,
+    0x00, 0xfe, 0x80,
+    0x00, 0xfc, 0xc0,
+    0x00, 0x78, 0xe0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x03, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x60, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '4'
+    0x00, 0x06, 0x00,
+    0x00, 0x1f, 0x00,
+    0x00, 0x1f, 0x00,
+    0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00,
+    0x01, 0xff, 0x00,
+    0x01, 0xff, 0x00,
+    0x07, 0xff, 0x00,
+    0x07, 0x9f, 0x00,
+    0x1f, 0x0f, 0x00,
+    0x1f, 0x0f, 0x00,
+    0x7e, 0x0f, 0x00,
+    0x78, 0x0f, 0x00,
+    0xf0, 0x1f, 0x80,
+    0xf0, 0x1f, 0x80,
+    0xf8, 0x7f, 0xe0,
+    0xff, 0xff, 0xe0,
+    0x7f, 0xff, 0xf0,
+    0x7f, 0xff, 0xf0,
+    0x1f, 0xff, 0xe0,
+    0x00, 0x7f, 0xe0,
+    0x00, 0x1f, 0x80,
+    0x00, 0x1f, 0x80,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '5'
+    0x1f, 0xff, 0xe0,
+    0x7f, 0xff, 0xf0,
+    0x7f, 0xff, 0xf0,
+    0xff, 0xff, 0xe0,
+    0xf8, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xff, 0xfe, 0x00,
+    0x7f, 0xff, 0x80,
+    0x7f, 0xff, 0x80,
+    0x1f, 0xff, 0xe0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x60, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '6'
+    0x00, 0x7f, 0xe0,
+    0x01, 0xff, 0xf0,
+    0x01, 0xff, 0xf0,
+    0x07, 0xff, 0xe0,
+    0x07, 0xe0, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x7e, 0x00, 0x00,
+    0x78, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xff, 0xfe, 0x00,
+    0xff, 0xff, 0x80,
+    0xff, 0xff, 0x80,
+    0xff, 0xff, 0xe0,
+    0xfe, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '7'
+    0x7f, 0xff, 0x80,
+    0xff, 0xff, 0xe0,
+    0xff, 0xff, 0xe0,
+    0x7f, 0xff, 0xf0,
+    0x00, 0x07, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x1f, 0x80,
+    0x00, 0x1f, 0x80,
+    0x00, 0x7e, 0x00,
+    0x00, 0x7e, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x07, 0xe0, 0x00,
+    0x07, 0xe0, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x7e, 0x00, 0x00,
+    0x7e, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '8'
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x0f, 0xff, 0x00,
+    0x0f, 0xff, 0x00,
+    0x1f, 0xff, 0x80,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '9'
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xf0,
+    0x7f, 0xff, 0xf0,
+    0x1f, 0xff, 0xf0,
+    0x1f, 0xff, 0xf0,
+    0x07, 0xff, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x01, 0xe0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x1f, 0x80,
+    0x00, 0x1f, 0x80,
+    0x00, 0x7e, 0x00,
+    0x7f, 0xfe, 0x00,
+    0xff, 0xf8, 0x00,
+    0xff, 0xf8, 0x00,
+    0x7f, 0xe0, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // ':'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x60,
+    0xf0,
+    0xf0,
+    0x60,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x60,
+    0xf0,
+    0xf0,
+    0x60,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // ';'
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x06, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x06, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x06, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x1f, 0x00,
+    0x1f, 0x00,
+    0x7e, 0x00,
+    0x7e, 0x00,
+    0xf8, 0x00,
+    0xf8, 0x00,
+    0x60, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '<'
+    0x00, 0x06, 0x00,
+    0x00, 0x1f, 0x00,
+    0x00, 0x1f, 0x00,
+    0x00, 0x7e, 0x00,
+    0x00, 0x7e, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x07, 0xe0, 0x00,
+    0x07, 0xe0, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x7e, 0x00, 0x00,
+    0x78, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0x78, 0x00, 0x00,
+    0x7e, 0x00, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x07, 0xe0, 0x00,
+    0x07, 0xe0, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x00, 0x7e, 0x00,
+    0x00, 0x7e, 0x00,
+    0x00, 0x1f, 0x00,
+    0x00, 0x1f, 0x00,
+    0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '='
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xe0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xe0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '>'
+    0x60, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0x7e, 0x00, 0x00,
+    0x7e, 0x00, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x07, 0xe0, 0x00,
+    0x07, 0xe0, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x00, 0x7e, 0x00,
+    0x00, 0x1e, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x1e, 0x00,
+    0x00, 0x7e, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x07, 0xe0, 0x00,
+    0x07, 0xe0, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x7e, 0x00, 0x00,
+    0x7e, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '?'
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x60, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x1f, 0xe0,
+    0x00, 0x7f, 0x80,
+    0x00, 0x7f, 0x80,
+    0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00,
+    0x00, 0xf8, 0x00,
+    0x00, 0xf8, 0x00,
+    0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x60, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '@'
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x60, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf9, 0xf0,
+    0xf0, 0xff, 0xf0,
+    0xf0, 0xff, 0xe0,
+    0xf0, 0xff, 0xe0,
+    0xf0, 0xff, 0xc0,
+    0xf0, 0xff, 0xc0,
+    0xf0, 0x7f, 0x80,
+    0xf0, 0x7e, 0x00,
+    0xf0, 0x18, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0x7e, 0x00, 0x00,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0xf0,
+    0x1f, 0xff, 0xf0,
+    0x07, 0xff, 0xe0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'A'
+    0x00, 0x60, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x07, 0xfe, 0x00,
+    0x07, 0x9e, 0x00,
+    0x1f, 0x0f, 0x80,
+    0x1f, 0x0f, 0x80,
+    0x7e, 0x07, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xfe, 0x07, 0xf0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0xfe, 0x07, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0x60, 0x00, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'B'
+    0x1f, 0xfe, 0x00,
+    0x7f, 0xff, 0x80,
+    0x7f, 0xff, 0x80,
+    0xff, 0xff, 0xe0,
+    0xfe, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xfe, 0x07, 0xe0,
+    0xff, 0xff, 0x80,
+    0xff, 0xff, 0x00,
+    0xff, 0xff, 0x00,
+    0xff, 0xff, 0x80,
+    0xfe, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xfe, 0x07, 0xe0,
+    0xff, 0xff, 0xe0,
+    0x7f, 0xff, 0x80,
+    0x7f, 0xff, 0x80,
+    0x1f, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'C'
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0x60,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x60,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'D'
+    0x1f, 0xfe, 0x00,
+    0x7f, 0xff, 0x80,
+    0x7f, 0xff, 0x80,
+    0xff, 0xff, 0xe0,
+    0xfe, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xfe, 0x07, 0xe0,
+    0xff, 0xff, 0xe0,
+    0x7f, 0xff, 0x80,
+    0x7f, 0xff, 0x80,
+    0x1f, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'E'
+    0x1f, 0xff, 0xe0,
+    0x7f, 0xff, 0xf0,
+    0x7f, 0xff, 0xf0,
+    0xff, 0xff, 0xe0,
+    0xfe, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xfe, 0x00, 0x00,
+    0xff, 0xfe, 0x00,
+    0xff, 0xff, 0x00,
+    0xff, 0xff, 0x00,
+    0xff, 0xfe, 0x00,
+    0xfe, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xfe, 0x00, 0x00,
+    0xff, 0xff, 0xe0,
+    0x7f, 0xff, 0xf0,
+    0x7f, 0xff, 0xf0,
+    0x1f, 0xff, 0xe0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'F'
+    0x1f, 0xff, 0xe0,
+    0x7f, 0xff, 0xf0,
+    0x7f, 0xff, 0xf0,
+    0xff, 0xff, 0xe0,
+    0xfe, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xfe, 0x00, 0x00,
+    0xff, 0xfe, 0x00,
+    0xff, 0xff, 0x00,
+    0xff, 0xff, 0x00,
+    0xff, 0xfe, 0x00,
+    0xfe, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'G'
+    0x07, 0xff, 0x80,
+    0x1f, 0xff, 0xe0,
+    0x1f, 0xff, 0xe0,
+    0x7f, 0xff, 0xf0,
+    0x7e, 0x07, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0x60,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x07, 0x80,
+    0xf0, 0x0f, 0xe0,
+    0xf0, 0x0f, 0xe0,
+    0xf0, 0x07, 0xf0,
+    0xf0, 0x01, 0xf0,
+    0xf8, 0x00, 0xf0,
+    0xf8, 0x00, 0xf0,
+    0x7e, 0x01, 0xf0,
+    0x7f, 0xff, 0xf0,
+    0x1f, 0xff, 0xe0,
+    0x1f, 0xff, 0xe0,
+    0x07, 0xff, 0x80,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'H'
+    0x60, 0x00, 0x60,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xfe, 0x07, 0xf0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0xfe, 0x07, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0x60, 0x00, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'I'
+    0x7f, 0xe0,
+    0xff, 0xf0,
+    0xff, 0xf0,
+    0x7f, 0xe0,
+    0x7f, 0xe0,
+    0x1f, 0x80,
+    0x1f, 0x80,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x1f, 0x80,
+    0x1f, 0x80,
+    0x7f, 0xe0,
+    0x7f, 0xe0,
+    0xff, 0xf0,
+    0xff, 0xf0,
+    0x7f, 0xe0,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'J'
+    0x00, 0x7f, 0xe0,
+    0x00, 0xff, 0xf0,
+    0x00, 0xff, 0xf0,
+    0x00, 0x7f, 0xe0,
+    0x00, 0x7f, 0xe0,
+    0x00, 0x1f, 0x80,
+    0x00, 0x1f, 0x80,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x60, 0x0f, 0x00,
+    0xf8, 0x1f, 0x00,
+    0xf8, 0x1f, 0x00,
+    0x7e, 0x7e, 0x00,
+    0x7f, 0xfe, 0x00,
+    0x1f, 0xf8, 0x00,
+    0x1f, 0xf8, 0x00,
+    0x07, 0xe0, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'K'
+    0x60, 0x00, 0x60,
+    0xf0, 0x01, 0xf0,
+    0xf0, 0x01, 0xf0,
+    0xf0, 0x07, 0xe0,
+    0xf0, 0x07, 0xe0,
+    0xf0, 0x1f, 0x80,
+    0xf0, 0x1f, 0x80,
+    0xf0, 0x7e, 0x00,
+    0xf0, 0x7e, 0x00,
+    0xf0, 0xf8, 0x00,
+    0xf0, 0xf8, 0x00,
+    0xf9, 0x60, 0x00,
+    0xfe, 0x80, 0x00,
+    0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00,
+    0xfe, 0x80, 0x00,
+    0xf9, 0x60, 0x00,
+    0xf0, 0xf8, 0x00,
+    0xf0, 0xf8, 0x00,
+    0xf0, 0x7e, 0x00,
+    0xf0, 0x7e, 0x00,
+    0xf0, 0x1f, 0x80,
+    0xf0, 0x1f, 0x80,
+    0xf0, 0x07, 0xe0,
+    0xf0, 0x07, 0xe0,
+    0xf0, 0x01, 0xf0,
+    0xf0, 0x01, 0xf0,
+    0x60, 0x00, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'L'
+    0x60, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xfe, 0x00, 0x00,
+    0xff, 0xff, 0xe0,
+    0x7f, 0xff, 0xf0,
+    0x7f, 0xff, 0xf0,
+    0x1f, 0xff, 0xe0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'M'
+    0x60, 0x00, 0x60,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xfe, 0x07, 0xf0,
+    0xfe, 0x07, 0xf0,
+    0xff, 0x0f, 0xf0,
+    0xff, 0x0f, 0xf0,
+    0xfe, 0x97, 0xf0,
+    0xf9, 0x69, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0x60, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0x60, 0x00, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'N'
+    0x60, 0x00, 0x60,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x00, 0xf0,
+    0xf8, 0x00, 0xf0,
+    0xfe, 0x00, 0xf0,
+    0xfe, 0x00, 0xf0,
+    0xff, 0x80, 0xf0,
+    0xff, 0x80, 0xf0,
+    0xff, 0xe0, 0xf0,
+    0xf9, 0xe0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0x79, 0xf0,
+    0xf0, 0x7f, 0xf0,
+    0xf0, 0x1f, 0xf0,
+    0xf0, 0x1f, 0xf0,
+    0xf0, 0x07, 0xf0,
+    0xf0, 0x07, 0xf0,
+    0xf0, 0x01, 0xf0,
+    0xf0, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0x60, 0x00, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'O'
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'P'
+    0x1f, 0xfe, 0x00,
+    0x7f, 0xff, 0x80,
+    0x7f, 0xff, 0x80,
+    0xff, 0xff, 0xe0,
+    0xfe, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xfe, 0x07, 0xe0,
+    0xff, 0xff, 0xe0,
+    0xff, 0xff, 0x80,
+    0xff, 0xff, 0x80,
+    0xff, 0xfe, 0x00,
+    0xfe, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'Q'
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x60, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0x69, 0x60,
+    0xf0, 0x16, 0x80,
+    0xf8, 0x0f, 0x00,
+    0xf8, 0x0f, 0x00,
+    0x7e, 0x16, 0x80,
+    0x7f, 0xe9, 0x60,
+    0x1f, 0xf0, 0xf0,
+    0x1f, 0xf0, 0xf0,
+    0x07, 0xe0, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'R'
+    0x1f, 0xfe, 0x00,
+    0x7f, 0xff, 0x80,
+    0x7f, 0xff, 0x80,
+    0xff, 0xff, 0xe0,
+    0xfe, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xfe, 0x07, 0xe0,
+    0xff, 0xff, 0xe0,
+    0xff, 0xff, 0x80,
+    0xff, 0xff, 0x80,
+    0xff, 0xfe, 0x00,
+    0xf9, 0xf8, 0x00,
+    0xf0, 0xf0, 0x00,
+    0xf0, 0xf0, 0x00,
+    0xf0, 0x78, 0x00,
+    0xf0, 0x7e, 0x00,
+    0xf0, 0x1f, 0x80,
+    0xf0, 0x1f, 0x80,
+    0xf0, 0x07, 0xe0,
+    0xf0, 0x07, 0xe0,
+    0xf0, 0x01, 0xf0,
+    0xf0, 0x01, 0xf0,
+    0x60, 0x00, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'S'
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0x60,
+    0xf0, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0x7e, 0x00, 0x00,
+    0x7f, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xff, 0xe0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x60, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'T'
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0xf0,
+    0xf9, 0xf9, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0x60, 0xf0, 0x60,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'U'
+    0x60, 0x00, 0x60,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'V'
+    0x60, 0x00, 0x60,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0x1f, 0x0f, 0x80,
+    0x1f, 0x0f, 0x80,
+    0x07, 0x9e, 0x00,
+    0x07, 0xfe, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'W'
+    0x60, 0x00, 0x60,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x60, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0x79, 0x69, 0xe0,
+    0x7e, 0x97, 0xe0,
+    0x1f, 0x0f, 0x80,
+    0x1f, 0x0f, 0x80,
+    0x06, 0x06, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'X'
+    0x60, 0x00, 0x60,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0x1f, 0x0f, 0x80,
+    0x1f, 0x0f, 0x80,
+    0x06, 0x96, 0x00,
+    0x01, 0x68, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x01, 0x68, 0x00,
+    0x06, 0x96, 0x00,
+    0x1f, 0x0f, 0x80,
+    0x1f, 0x0f, 0x80,
+    0x7e, 0x07, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0x60, 0x00, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'Y'
+    0x60, 0x00, 0x60,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0x1f, 0x0f, 0x80,
+    0x1f, 0x0f, 0x80,
+    0x07, 0x9e, 0x00,
+    0x07, 0xfe, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'Z'
+    0x7f, 0xff, 0x80,
+    0xff, 0xff, 0xe0,
+    0xff, 0xff, 0xe0,
+    0x7f, 0xff, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x01, 0xe0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x1f, 0x80,
+    0x00, 0x1f, 0x80,
+    0x00, 0x7f, 0x00,
+    0x01, 0xff, 0x00,
+    0x07, 0xfe, 0x00,
+    0x07, 0xfe, 0x00,
+    0x0f, 0xf8, 0x00,
+    0x0f, 0xe0, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x7e, 0x00, 0x00,
+    0x78, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xff, 0xff, 0xe0,
+    0x7f, 0xff, 0xf0,
+    0x7f, 0xff, 0xf0,
+    0x1f, 0xff, 0xe0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '['
+    0x1f, 0xfe, 0x00,
+    0x7f, 0xff, 0x00,
+    0x7f, 0xff, 0x00,
+    0xff, 0xfe, 0x00,
+    0xfe, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xfe, 0x00, 0x00,
+    0xff, 0xfe, 0x00,
+    0x7f, 0xff, 0x00,
+    0x7f, 0xff, 0x00,
+    0x1f, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '\'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x60, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0x7e, 0x00, 0x00,
+    0x7e, 0x00, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x07, 0xe0, 0x00,
+    0x07, 0xe0, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x00, 0x7e, 0x00,
+    0x00, 0x7e, 0x00,
+    0x00, 0x1f, 0x80,
+    0x00, 0x1f, 0x80,
+    0x00, 0x07, 0xe0,
+    0x00, 0x07, 0xe0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x00, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // ']'
+    0x7f, 0xf8, 0x00,
+    0xff, 0xfe, 0x00,
+    0xff, 0xfe, 0x00,
+    0x7f, 0xff, 0x00,
+    0x00, 0x7f, 0x00,
+    0x00, 0x1f, 0x00,
+    0x00, 0x1f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x1f, 0x00,
+    0x00, 0x1f, 0x00,
+    0x00, 0x7f, 0x00,
+    0x7f, 0xff, 0x00,
+    0xff, 0xfe, 0x00,
+    0xff, 0xfe, 0x00,
+    0x7f, 0xf8, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '^'
+    0x00, 0x60, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x07, 0xfe, 0x00,
+    0x07, 0x9e, 0x00,
+    0x1f, 0x0f, 0x80,
+    0x1f, 0x0f, 0x80,
+    0x7e, 0x07, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x60, 0x00, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '_'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xe0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '`'
+    0x18, 0x00,
+    0x7e, 0x00,
+    0x7e, 0x00,
+    0xff, 0x00,
+    0xff, 0x00,
+    0x7f, 0x00,
+    0x7f, 0x00,
+    0x3f, 0x00,
+    0x3f, 0x00,
+    0x1f, 0x80,
+    0x1f, 0x80,
+    0x07, 0xe0,
+    0x07, 0xe0,
+    0x01, 0xf0,
+    0x01, 0xf0,
+    0x00, 0x60,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'a'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x07, 0xe0, 0x00,
+    0x0f, 0xf8, 0x00,
+    0x0f, 0xf8, 0x00,
+    0x07, 0xfe, 0x00,
+    0x00, 0x1e, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x1f, 0x00,
+    0x07, 0xff, 0x00,
+    0x1f, 0xff, 0x00,
+    0x1f, 0xff, 0x00,
+    0x7f, 0xff, 0x00,
+    0x78, 0x1f, 0x00,
+    0xf0, 0x0f, 0x80,
+    0xf0, 0x0f, 0x80,
+    0x78, 0x1f, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0xf0,
+    0x1f, 0xff, 0xf0,
+    0x07, 0xff, 0xe0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'b'
+    0x60, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x7e, 0x00,
+    0xf0, 0xff, 0x80,
+    0xf0, 0xff, 0x80,
+    0xf9, 0xff, 0xe0,
+    0xff, 0xe7, 0xe0,
+    0xff, 0x81, 0xf0,
+    0xff, 0x81, 0xf0,
+    0xfe, 0x00, 0xf0,
+    0xf8, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x00, 0xf0,
+    0xfe, 0x00, 0xf0,
+    0xff, 0x81, 0xf0,
+    0xff, 0x81, 0xf0,
+    0xff, 0xe7, 0xe0,
+    0xf9, 0xff, 0xe0,
+    0xf0, 0xff, 0x80,
+    0xf0, 0xff, 0x80,
+    0x60, 0x7e, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'c'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0x60,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x60,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'd'
+    0x00, 0x00, 0x60,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x07, 0xe0, 0xf0,
+    0x1f, 0xf0, 0xf0,
+    0x1f, 0xf0, 0xf0,
+    0x7f, 0xf9, 0xf0,
+    0x7e, 0x7f, 0xf0,
+    0xf8, 0x1f, 0xf0,
+    0xf8, 0x1f, 0xf0,
+    0xf0, 0x07, 0xf0,
+    0xf0, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x01, 0xf0,
+    0xf0, 0x07, 0xf0,
+    0xf8, 0x1f, 0xf0,
+    0xf8, 0x1f, 0xf0,
+    0x7e, 0x7f, 0xf0,
+    0x7f, 0xf9, 0xf0,
+    0x1f, 0xf0, 0xf0,
+    0x1f, 0xf0, 0xf0,
+    0x07, 0xe0, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'e'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x78, 0x01, 0xe0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xe0,
+    0xff, 0xff, 0xe0,
+    0xff, 0xff, 0x80,
+    0xf8, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0x78, 0x00, 0x00,
+    0x7f, 0xfe, 0x00,
+    0x1f, 0xff, 0x00,
+    0x1f, 0xff, 0x00,
+    0x07, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'f'
+    0x00, 0x60, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x07, 0xfe, 0x00,
+    0x07, 0x9e, 0x00,
+    0x0f, 0x0f, 0x00,
+    0x0f, 0x0f, 0x00,
+    0x0f, 0x06, 0x00,
+    0x0f, 0x00, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x7f, 0xe0, 0x00,
+    0x7f, 0xe0, 0x00,
+    0xff, 0xf0, 0x00,
+    0xff, 0xf0, 0x00,
+    0x7f, 0xe0, 0x00,
+    0x7f, 0xe0, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x0f, 0x00, 0x00,
+    0x0f, 0x00, 0x00,
+    0x0f, 0x00, 0x00,
+    0x0f, 0x00, 0x00,
+    0x0f, 0x00, 0x00,
+    0x0f, 0x00, 0x00,
+    0x0f, 0x00, 0x00,
+    0x0f, 0x00, 0x00,
+    0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'g'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x07, 0xf8, 0x00,
+    0x1f, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xc0,
+    0x7e, 0x7f, 0xc0,
+    0xf8, 0x1f, 0xe0,
+    0xf8, 0x1f, 0xe0,
+    0xf0, 0x0f, 0xf0,
+    0xf0, 0x0f, 0xf0,
+    0xf8, 0x17, 0xf0,
+    0xf8, 0x33, 0xf0,
+    0x7e, 0x71, 0xf0,
+    0x7f, 0xf1, 0xf0,
+    0x1f, 0xf0, 0xf0,
+    0x1f, 0xf0, 0xf0,
+    0x07, 0xe0, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x07, 0xe0,
+    0x07, 0xff, 0xe0,
+    0x0f, 0xff, 0x80,
+    0x0f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    // 'h'
+    0x60, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x7e, 0x00,
+    0xf0, 0xff, 0x80,
+    0xf0, 0xff, 0x80,
+    0xf9, 0xff, 0xe0,
+    0xff, 0xe7, 0xe0,
+    0xff, 0x81, 0xf0,
+    0xff, 0x81, 0xf0,
+    0xfe, 0x00, 0xf0,
+    0xfe, 0x00, 0xf0,
+    0xf8, 0x00, 0xf0,
+    0xf8, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0x60, 0x00, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'i'
+    0x06, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x06, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x78, 0x00,
+    0xfe, 0x00,
+    0xfe, 0x00,
+    0x7f, 0x00,
+    0x7f, 0x00,
+    0x1f, 0x00,
+    0x1f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x1f, 0x80,
+    0x1f, 0x80,
+    0x7f, 0xe0,
+    0x7f, 0xe0,
+    0xff, 0xf0,
+    0xff, 0xf0,
+    0x7f, 0xe0,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'j'
+    0x00, 0x06, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x00, 0x0f, 0x00,
+    0x60, 0x0f, 0x00,
+    0xf8, 0x1f, 0x00,
+    0xf8, 0x1f, 0x00,
+    0x7e, 0x7e, 0x00,
+    0x7f, 0xfe, 0x00,
+    0x1f, 0xf8, 0x00,
+    0x1f, 0xf8, 0x00,
+    0x07, 0xe0, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'k'
+    0x60, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x06, 0x00,
+    0xf0, 0x1f, 0x00,
+    0xf0, 0x1f, 0x00,
+    0xf0, 0x7e, 0x00,
+    0xf0, 0x7e, 0x00,
+    0xf0, 0xf8, 0x00,
+    0xf0, 0xf8, 0x00,
+    0xf9, 0x60, 0x00,
+    0xfe, 0x80, 0x00,
+    0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00,
+    0xfe, 0x80, 0x00,
+    0xf9, 0x60, 0x00,
+    0xf0, 0xf8, 0x00,
+    0xf0, 0xf8, 0x00,
+    0xf0, 0x7e, 0x00,
+    0xf0, 0x7e, 0x00,
+    0xf0, 0x1f, 0x00,
+    0xf0, 0x1f, 0x00,
+    0x60, 0x06, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'l'
+    0x78, 0x00,
+    0xfe, 0x00,
+    0xfe, 0x00,
+    0x7f, 0x00,
+    0x7f, 0x00,
+    0x1f, 0x00,
+    0x1f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x1f, 0x80,
+    0x1f, 0x80,
+    0x7f, 0xe0,
+    0x7f, 0xe0,
+    0xff, 0xf0,
+    0xff, 0xf0,
+    0x7f, 0xe0,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // 'm'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x1e, 0x06, 0x00,
+    0x7f, 0x0f, 0x80,
+    0x7f, 0x0f, 0x80,
+    0xfe, 0x97, 0xe0,
+    0xf9, 0x69, 0xe0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0x60, 0x60, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'n'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x60, 0x7e, 0x00,
+    0xf0, 0xff, 0x80,
+    0xf0, 0xff, 0x80,
+    0xf9, 0xff, 0xe0,
+    0xff, 0xe7, 0xe0,
+    0xff, 0x81, 0xf0,
+    0xff, 0x81, 0xf0,
+    0xfe, 0x00, 0xf0,
+    0xfe, 0x00, 0xf0,
+    0xf8, 0x00, 0xf0,
+    0xf8, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0x60, 0x00, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'o'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x07, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x7f, 0xff, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'p'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x60, 0x7e, 0x00,
+    0xf0, 0xff, 0x80,
+    0xf0, 0xff, 0x80,
+    0xf8, 0xff, 0xe0,
+    0xf8, 0xe7, 0xe0,
+    0xfc, 0xc1, 0xf0,
+    0xfe, 0x81, 0xf0,
+    0xff, 0x00, 0xf0,
+    0xff, 0x00, 0xf0,
+    0xfe, 0x81, 0xf0,
+    0xfc, 0xc1, 0xf0,
+    0xf8, 0xe7, 0xe0,
+    0xf8, 0xff, 0xe0,
+    0xf0, 0xff, 0x80,
+    0xf0, 0xff, 0x80,
+    0xf0, 0x7e, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0x60, 0x00, 0x00,
+    // 'q'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x07, 0xe0, 0x60,
+    0x1f, 0xf0, 0xf0,
+    0x1f, 0xf0, 0xf0,
+    0x7f, 0xf1, 0xf0,
+    0x7e, 0x71, 0xf0,
+    0xf8, 0x33, 0xf0,
+    0xf8, 0x17, 0xf0,
+    0xf0, 0x0f, 0xf0,
+    0xf0, 0x0f, 0xf0,
+    0xf8, 0x17, 0xf0,
+    0xf8, 0x33, 0xf0,
+    0x7e, 0x71, 0xf0,
+    0x7f, 0xf1, 0xf0,
+    0x1f, 0xf0, 0xf0,
+    0x1f, 0xf0, 0xf0,
+    0x07, 0xe0, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0x60,
+    // 'r'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x60, 0x7e, 0x00,
+    0xf0, 0xff, 0x80,
+    0xf0, 0xff, 0x80,
+    0xf9, 0xff, 0xe0,
+    0xff, 0xe7, 0xe0,
+    0xff, 0x81, 0xf0,
+    0xff, 0x81, 0xf0,
+    0xfe, 0x00, 0x60,
+    0xfe, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 's'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x07, 0xff, 0xe0,
+    0x1f, 0xff, 0xf0,
+    0x1f, 0xff, 0xf0,
+    0x7f, 0xff, 0xe0,
+    0x78, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00,
+    0x78, 0x00, 0x00,
+    0x7f, 0xfe, 0x00,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xff, 0xe0,
+    0x00, 0x01, 0xe0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x00, 0x01, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0x80,
+    0xff, 0xff, 0x80,
+    0x7f, 0xfe, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 't'
+    0x00, 0x60, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x07, 0xfe, 0x00,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xe0,
+    0x07, 0xfe, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x60,
+    0x00, 0xf0, 0xf0,
+    0x00, 0xf0, 0xf0,
+    0x00, 0x79, 0xe0,
+    0x00, 0x7f, 0xe0,
+    0x00, 0x1f, 0x80,
+    0x00, 0x1f, 0x80,
+    0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'u'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x60, 0x00, 0x60,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x01, 0xf0,
+    0xf0, 0x01, 0xf0,
+    0xf0, 0x07, 0xf0,
+    0xf0, 0x07, 0xf0,
+    0xf8, 0x1f, 0xf0,
+    0xf8, 0x1f, 0xf0,
+    0x7e, 0x7f, 0xf0,
+    0x7f, 0xf9, 0xf0,
+    0x1f, 0xf0, 0xf0,
+    0x1f, 0xf0, 0xf0,
+    0x07, 0xe0, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'v'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x60, 0x00, 0x60,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0x1f, 0x0f, 0x80,
+    0x1f, 0x0f, 0x80,
+    0x07, 0x9e, 0x00,
+    0x07, 0xfe, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'w'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x60, 0x00, 0x60,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x60, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0x79, 0x69, 0xe0,
+    0x7e, 0x97, 0xe0,
+    0x1f, 0x0f, 0x80,
+    0x1f, 0x0f, 0x80,
+    0x06, 0x06, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'x'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x60, 0x00, 0x60,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0x1f, 0x0f, 0x80,
+    0x1f, 0x0f, 0x80,
+    0x06, 0x96, 0x00,
+    0x01, 0x68, 0x00,
+    0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00,
+    0x01, 0x68, 0x00,
+    0x06, 0x96, 0x00,
+    0x1f, 0x0f, 0x80,
+    0x1f, 0x0f, 0x80,
+    0x7e, 0x07, 0xe0,
+    0x7e, 0x07, 0xe0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x60, 0x00, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // 'y'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x60, 0x00, 0x60,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xf0,
+    0x7f, 0xff, 0xf0,
+    0x1f, 0xff, 0xf0,
+    0x1f, 0xff, 0xf0,
+    0x07, 0xff, 0xf0,
+    0x00, 0x07, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x01, 0xf0,
+    0x00, 0x00, 0xf0,
+    0x60, 0x00, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0,
+    0x7e, 0x07, 0xe0,
+    0x7f, 0xff, 0xe0,
+    0x1f, 0xff, 0x80,
+    0x1f, 0xff, 0x80,
+    0x07, 0xfe, 0x00,
+    // 'z'
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xe0,
+    0x00, 0x1f, 0xe0,
+    0x00, 0x0f, 0x80,
+    0x00, 0x0f, 0x80,
+    0x00, 0x1e, 0x00,
+    0x00, 0x7e, 0x00,
+    0x01, 0xf8, 0x00,
+    0x01, 0xf8, 0x00,
+    0x07, 0xe0, 0x00,
+    0x07, 0x80, 0x00,
+    0x1f, 0x00, 0x00,
+    0x1f, 0x00, 0x00,
+    0x7f, 0x80, 0x00,
+    0x7f, 0xff, 0xe0,
+    0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xe0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // '{'
+    0x00, 0x60,
+    0x01, 0xf0,
+    0x01, 0xf0,
+    0x07, 0xe0,
+    0x07, 0xe0,
+    0x0f, 0x80,
+    0x0f, 0x80,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x1f, 0x00,
+    0x1f, 0x00,
+    0x7e, 0x00,
+    0x78, 0x00,
+    0xf0, 0x00,
+    0xf0, 0x00,
+    0x78, 0x00,
+    0x7e, 0x00,
+    0x1f, 0x00,
+    0x1f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x80,
+    0x0f, 0x80,
+    0x07, 0xe0,
+    0x07, 0xe0,
+    0x01, 0xf0,
+    0x01, 0xf0,
+    0x00, 0x60,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '|'
+    0x60,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0x60,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x60,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0xf0,
+    0x60,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '}'
+    0x60, 0x00,
+    0xf8, 0x00,
+    0xf8, 0x00,
+    0x7e, 0x00,
+    0x7e, 0x00,
+    0x1f, 0x00,
+    0x1f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x0f, 0x80,
+    0x0f, 0x80,
+    0x07, 0xe0,
+    0x01, 0xe0,
+    0x00, 0xf0,
+    0x00, 0xf0,
+    0x01, 0xe0,
+    0x07, 0xe0,
+    0x0f, 0x80,
+    0x0f, 0x80,
+    0x0f, 0x00,
+    0x0f, 0x00,
+    0x1f, 0x00,
+    0x1f, 0x00,
+    0x7e, 0x00,
+    0x7e, 0x00,
+    0xf8, 0x00,
+    0xf8, 0x00,
+    0x60, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // '~'
+    0x06, 0x00, 0x00,
+    0x1f, 0x80, 0x00,
+    0x1f, 0x80, 0x00,
+    0x7f, 0xe0, 0x00,
+    0x79, 0xe0, 0x60,
+    0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0,
+    0x60, 0x79, 0xe0,
+    0x00, 0x7f, 0xe0,
+    0x00, 0x1f, 0x80,
+    0x00, 0x1f, 0x80,
+    0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+};
+
+const struct tft_font tft_font32 = {
+    32, 126, 32, 1,
+    tft_font32_width, tft_font32_offset, tft_font32_data
+};
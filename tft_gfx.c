@@ -44,6 +44,12 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
 
+// nothing of the w x h box at (x,y) is inside the clip rectangle: the
+// whole primitive can be dropped before any of it is worked out
+static char tft_offClip(short x, short y, short w, short h) {
+  return tft_clipRect(&x, &y, &w, &h) == TFT_CLIP_OUT;
+}
+
 void tft_drawCircle(short x0, short y0, short r, unsigned short color) {
 /* Draw a circle outline with center (x0,y0) and radius r, with given color
  * Parameters:
@@ -62,6 +68,7 @@ void tft_drawCircle(short x0, short y0, short r, unsigned short color) {
   short x = 0;
   short y = r;
 
+  if (tft_offClip(x0-r, y0-r, 2*r+1, 2*r+1)) return;
   tft_drawPixel(x0  , y0+r, color);
   tft_drawPixel(x0  , y0-r, color);
   tft_drawPixel(x0+r, y0  , color);
@@ -125,6 +132,52 @@ void tft_drawCircleHelper( short x0, short y0,
   }
 }
 
+// === filled circle spans ===
+// A filled circle is a set of columns, symmetric about the center. The
+// table of their half heights (dx = 0..r) is worked out with the same
+// midpoint steps as tft_fillCircleHelper(), so the pixels are identical,
+// and kept for the last few radii: a moving ball costs the loop once.
+// Columns of equal height next to each other then go out as one
+// rectangle, one address window for many tft_drawFastVLine() calls.
+#define SPAN_MAXR   63  // bigger circles take tft_fillCircleHelper()
+#define SPAN_SLOTS  4   // radii kept
+static unsigned char span_tab[SPAN_SLOTS][SPAN_MAXR+1];
+static short span_r[SPAN_SLOTS] = {-1, -1, -1, -1};
+static unsigned char span_next;
+
+static const unsigned char *tft_circleSpans(short r) {
+  short f     = 1 - r;
+  short ddF_x = 1;
+  short ddF_y = -2 * r;
+  short x     = 0;
+  short y     = r;
+  unsigned char i, *t;
+
+  if ((r < 0) || (r > SPAN_MAXR)) return 0;
+  for (i=0; i<SPAN_SLOTS; i++)
+    if (span_r[i] == r) return span_tab[i];
+  t = span_tab[span_next];
+  span_r[span_next] = r;
+  span_next = (span_next + 1) % SPAN_SLOTS;
+
+  for (i=0; i<=r; i++) t[i] = 0;
+  t[0] = r;
+  while (x<y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f     += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f     += ddF_x;
+    // tft_fillCircleHelper() draws columns x and y of these heights
+    if (t[x] < y) t[x] = y;
+    if (t[y] < x) t[y] = x;
+  }
+  return t;
+}
+
 void tft_fillCircle(short x0, short y0, short r, unsigned short color) {
 /* Draw a filled circle with center (x0,y0) and radius r, with given color
  * Parameters:
@@ -136,8 +189,63 @@ void tft_fillCircle(short x0, short y0, short r, unsigned short color) {
  *      color: 16-bit color value for the circle
  * Returns: Nothing
  */
-  tft_drawFastVLine(x0, y0-r, 2*r+1, color);
-  tft_fillCircleHelper(x0, y0, r, 3, 0, color);
+  const unsigned char *t;
+  short k, dx;
+
+  if (tft_offClip(x0-r, y0-r, 2*r+1, 2*r+1)) return;
+  t = tft_circleSpans(r);
+  if (!t) {
+    tft_drawFastVLine(x0, y0-r, 2*r+1, color);
+    tft_fillCircleHelper(x0, y0, r, 3, 0, color);
+    return;
+  }
+  // the middle columns are all full height: one rectangle
+  for (k = 0; k < r && t[k+1] == r; k++);
+  tft_fillRect(x0-k, y0-r, 2*k+1, 2*r+1, color);
+  // then runs of equal height columns, right and left on the same rows
+  for (dx = k+1; dx <= r; dx = k+1) {
+    for (k = dx; k < r && t[k+1] == t[dx]; k++);
+    tft_fillRect(x0+dx, y0-t[dx], k-dx+1, 2*t[dx]+1, color);
+    tft_fillRect(x0-k, y0-t[dx], k-dx+1, 2*t[dx]+1, color);
+  }
+}
+
+void tft_fillCircleBg(short x0, short y0, short r, unsigned short color,
+    unsigned short bg) {
+/* Draw a filled circle with center (x0,y0) and radius r, with given color,
+ *  on a square of background color
+ * Parameters:
+ *      x0, y0, r, color: same as tft_fillCircle()
+ *      bg: 16-bit color value for the rest of the bounding square
+ * Returns: Nothing
+ * Note: the whole (2r+1) x (2r+1) square goes out as a single address
+ *      window, row by row. Cheaper than tft_fillCircle() for small circles
+ *      that move over a plain background, e.g. a ball in an animation
+ */
+  const unsigned char *t = tft_circleSpans(r);
+  short dy, a, hw = 0, x = x0-r, y = y0-r, w = 2*r+1, h = 2*r+1;
+  unsigned long run = 0;
+  char clip = tft_clipRect(&x, &y, &w, &h);
+
+  if (clip == TFT_CLIP_OUT) return;
+  if (!t || tft_fill_hook || (clip != TFT_CLIP_IN)) {
+    tft_fillRect(x0-r, y0-r, 2*r+1, 2*r+1, bg);
+    tft_fillCircle(x0, y0, r, color);
+    return;
+  }
+  tft_setAddrWindow(x, y, x+w-1, y+h-1);
+  for (dy = -r; dy <= r; dy++) {
+    a = (dy < 0) ? -dy : dy;
+    // widest column reaching this row
+    while (hw < r && t[hw+1] >= a) hw++;
+    while (t[hw] < a) hw--;
+    // background right of one row and left of the next is one run
+    run += r - hw;
+    if (run) tft_pushRun(bg, run);
+    tft_pushRun(color, 2*hw+1);
+    run = r - hw;
+  }
+  if (run) tft_pushRun(r ? bg : color, run);
 }
 
 void tft_fillCircleHelper(short x0, short y0, short r,
@@ -159,64 +267,191 @@ void tft_fillCircleHelper(short x0, short y0, short r,
     ddF_x += 2;
     f     += ddF_x;
 
-    if (cornername & 0x1) {
-      tft_drawFastVLine(x0+x, y0-y, 2*y+1+delta, color);
-      tft_drawFastVLine(x0+y, y0-x, 2*x+1+delta, color);
+    // spans sharing the same rows go out back to back, so the second
+    // one only needs a new CASET (see tft_setAddrWindow)
+    if (cornername & 0x1) tft_drawFastVLine(x0+x, y0-y, 2*y+1+delta, color);
+    if (cornername & 0x2) tft_drawFastVLine(x0-x, y0-y, 2*y+1+delta, color);
+    if (cornername & 0x1) tft_drawFastVLine(x0+y, y0-x, 2*x+1+delta, color);
+    if (cornername & 0x2) tft_drawFastVLine(x0-y, y0-x, 2*x+1+delta, color);
+  }
+}
+
+// === line runs ===
+// Bresenham steps along the major axis of a line; the pixels that share a
+// row (or a column, for a steep line) go out as one fast line instead of
+// one tft_drawPixel() window each. The last span is held back, so the
+// next one can still join it: a polyline segment that carries on along
+// the same row or column continues the previous segment's span.
+static short run_x, run_y, run_len = 0;
+static char run_vert;
+static unsigned short run_color;
+// pixel that a polyline segment shares with the one before it
+static short skip_x, skip_y;
+static char skip_on = 0;
+
+static void tft_lineFlush(void) {
+// draw the held back span; the fast lines clip it
+  short n = run_len;
+
+  run_len = 0;
+  if (n <= 0) return;
+  if (n == 1) tft_drawPixel(run_x, run_y, run_color);
+  else if (run_vert) tft_drawFastVLine(run_x, run_y, n, run_color);
+  else tft_drawFastHLine(run_x, run_y, n, run_color);
+}
+
+static void tft_lineSpan(short x, short y, short n, char vert,
+    unsigned short color) {
+// n pixels from (x,y) to the right, or down if vert
+  short e;
+
+  if (skip_on) {
+    // leave out the shared pixel, it is at one end of the span
+    if ((x == skip_x) && (y == skip_y)) {
+      skip_on = 0;
+      n--;
+      if (vert) y++; else x++;
+    } else if (vert ? (x == skip_x && y + n - 1 == skip_y)
+                    : (y == skip_y && x + n - 1 == skip_x)) {
+      skip_on = 0;
+      n--;
     }
-    if (cornername & 0x2) {
-      tft_drawFastVLine(x0-x, y0-y, 2*y+1+delta, color);
-      tft_drawFastVLine(x0-y, y0-x, 2*x+1+delta, color);
+    if (n <= 0) return;
+  }
+  if (run_len && (color == run_color)) {
+    // a single pixel goes either way
+    if ((!run_vert || run_len == 1) && (!vert || n == 1) &&
+        (y == run_y) && (x <= run_x + run_len) && (x + n >= run_x)) {
+      e = (x + n > run_x + run_len) ? x + n : run_x + run_len;
+      if (x < run_x) run_x = x;
+      run_len = e - run_x;
+      run_vert = 0;
+      return;
+    }
+    if ((run_vert || run_len == 1) && (vert || n == 1) &&
+        (x == run_x) && (y <= run_y + run_len) && (y + n >= run_y)) {
+      e = (y + n > run_y + run_len) ? y + n : run_y + run_len;
+      if (y < run_y) run_y = y;
+      run_len = e - run_y;
+      run_vert = 1;
+      return;
     }
   }
+  tft_lineFlush();
+  run_x = x;
+  run_y = y;
+  run_len = n;
+  run_vert = vert;
+  run_color = color;
 }
 
-// Bresenham's algorithm - thx wikpedia
-void tft_drawLine(short x0, short y0,
-			    short x1, short y1,
-			    unsigned short color) {
-/* Draw a straight line from (x0,y0) to (x1,y1) with given color
- * Parameters:
- *      x0: x-coordinate of starting point of line. The x-coordinate of
- *          the top-left of the screen is 0. It increases to the right.
- *      y0: y-coordinate of starting point of line. The y-coordinate of
- *          the top-left of the screen is 0. It increases to the bottom.
- *      x1: x-coordinate of ending point of line. The x-coordinate of
- *          the top-left of the screen is 0. It increases to the right.
- *      y1: y-coordinate of ending point of line. The y-coordinate of
- *          the top-left of the screen is 0. It increases to the bottom.
- *      color: 16-bit color value for line
- */
-  short steep = abs(y1 - y0) > abs(x1 - x0);
+// Cohen-Sutherland outcode of (x,y): on which sides of the clip rectangle
+// cx0..cx1, cy0..cy1 (inclusive) it lies
+#define OUT_LEFT    1
+#define OUT_RIGHT   2
+#define OUT_TOP     4
+#define OUT_BOTTOM  8
+static short cx0, cy0, cx1, cy1;
+
+static unsigned char tft_outcode(short x, short y) {
+  unsigned char c = 0;
+
+  if (x < cx0) c |= OUT_LEFT;
+  else if (x > cx1) c |= OUT_RIGHT;
+  if (y < cy0) c |= OUT_TOP;
+  else if (y > cy1) c |= OUT_BOTTOM;
+  return c;
+}
+
+// first Bresenham step k (0..dx) at which the minor axis has already
+// moved m times, dx+1 if it never does. By step k it has moved
+// ceil((k*dy - dx/2) / dx) times (0 if that is negative)
+static short tft_lineStep(long m, short dx, short dy) {
+  if (m <= 0) return 0;
+  if (m > dy) return dx + 1;
+  return ((m - 1) * dx + dx / 2) / dy + 1;
+}
+
+static void tft_lineSegment(short x0, short y0, short x1, short y1,
+    unsigned short color) {
+// the pixels of tft_drawLine(), as spans; the last one is held back.
+// Only the steps that can land inside the clip rectangle are taken
+  short steep, dx, dy, err, ystep, start, xe, lo, hi, k;
+  unsigned char c0, c1;
+  long m;
+
+  // the clip rectangle relative to the origin
+  cx0 = tft_clip_x0 - tft_org_x;
+  cy0 = tft_clip_y0 - tft_org_y;
+  cx1 = tft_clip_x1 - 1 - tft_org_x;
+  cy1 = tft_clip_y1 - 1 - tft_org_y;
+  c0 = tft_outcode(x0, y0);
+  c1 = tft_outcode(x1, y1);
+  // both ends beyond the same side: nothing to draw
+  if (c0 & c1) return;
+
+  // axis aligned: a single span
+  if (y0 == y1) {
+    if (x0 > x1) swap(x0, x1);
+    tft_lineSpan(x0, y0, x1 - x0 + 1, 0, color);
+    return;
+  }
+  if (x0 == x1) {
+    if (y0 > y1) swap(y0, y1);
+    tft_lineSpan(x0, y0, y1 - y0 + 1, 1, color);
+    return;
+  }
+
+  steep = abs(y1 - y0) > abs(x1 - x0);
   if (steep) {
     swap(x0, y0);
     swap(x1, y1);
   }
-
   if (x0 > x1) {
     swap(x0, x1);
     swap(y0, y1);
   }
-
-  short dx, dy;
   dx = x1 - x0;
   dy = abs(y1 - y0);
+  ystep = (y0 < y1) ? 1 : -1;
 
-  short err = dx / 2;
-  short ystep;
+  // steps lo..hi, cut to the clip rectangle along both axes
+  lo = 0;
+  hi = dx;
+  if (c0 | c1) {
+    if (steep) {
+      swap(cx0, cy0);
+      swap(cx1, cy1);
+    }
+    if (cx0 - x0 > lo) lo = cx0 - x0;
+    if (cx1 - x0 < hi) hi = cx1 - x0;
+    k = tft_lineStep((ystep > 0) ? cy0 - y0 : y0 - cy1, dx, dy);
+    if (k > lo) lo = k;
+    k = tft_lineStep((ystep > 0) ? cy1 - y0 + 1 : y0 - cy0 + 1, dx, dy) - 1;
+    if (k < hi) hi = k;
+    if (lo > hi) return;
+  }
+  // Bresenham state at step lo: err stays in 0..dx-1
+  m = ((long)lo * dy > dx / 2) ? ((long)lo * dy - dx / 2 + dx - 1) / dx : 0;
+  err = dx / 2 + m * dx - (long)lo * dy;
+  y0 += (ystep > 0) ? m : -m;
+  xe = x0 + hi;
+  x0 += lo;
 
-  if (y0 < y1) {
-    ystep = 1;
-  } else {
-    ystep = -1;
+  // 45 degrees: every pixel on a row (and column) of its own
+  if (dx == dy) {
+    for (; x0<=xe; x0++, y0 += ystep) tft_lineSpan(x0, y0, 1, 0, color);
+    return;
   }
 
-  for (; x0<=x1; x0++) {
-    if (steep) {
-      tft_drawPixel(y0, x0, color);
-    } else {
-      tft_drawPixel(x0, y0, color);
-    }
+  for (start = x0; x0<=xe; x0++) {
     err -= dy;
+    if ((err < 0) || (x0 == xe)) {
+      // end of the run on this row (column if steep)
+      if (steep) tft_lineSpan(y0, start, x0 - start + 1, 1, color);
+      else       tft_lineSpan(start, y0, x0 - start + 1, 0, color);
+      start = x0 + 1;
+    }
     if (err < 0) {
       y0 += ystep;
       err += dx;
@@ -224,6 +459,59 @@ void tft_drawLine(short x0, short y0,
   }
 }
 
+// Bresenham's algorithm - thx wikpedia
+void tft_drawLine(short x0, short y0,
+			    short x1, short y1,
+			    unsigned short color) {
+/* Draw a straight line from (x0,y0) to (x1,y1) with given color
+ * Parameters:
+ *      x0: x-coordinate of starting point of line. The x-coordinate of
+ *          the top-left of the screen is 0. It increases to the right.
+ *      y0: y-coordinate of starting point of line. The y-coordinate of
+ *          the top-left of the screen is 0. It increases to the bottom.
+ *      x1: x-coordinate of ending point of line. The x-coordinate of
+ *          the top-left of the screen is 0. It increases to the right.
+ *      y1: y-coordinate of ending point of line. The y-coordinate of
+ *          the top-left of the screen is 0. It increases to the bottom.
+ *      color: 16-bit color value for line
+ * Note: runs of pixels on one row (column) go out as one
+ *      tft_drawFastHLine() (tft_drawFastVLine()); the pixels are the same
+ *      as plotting each with tft_drawPixel(). A line with both ends past
+ *      the same edge of the clip rectangle costs nothing, and one that
+ *      crosses an edge only works out the pixels inside it
+ */
+  tft_lineSegment(x0, y0, x1, y1, color);
+  tft_lineFlush();
+}
+
+void tft_drawPolyline(const short *x, const short *y, short n,
+    unsigned short color) {
+/* Draw straight lines through n points with given color
+ * Parameters:
+ *      x:  x-coordinates of the points
+ *      y:  y-coordinates of the points
+ *      n:  number of points, so n-1 lines
+ *      color: 16-bit color value for the lines
+ * Returns: Nothing
+ * Note: made for scope traces and chart lines. The point two lines share
+ *      is drawn once, and a span that runs on into the next line goes out
+ *      as one, so the lines share their address windows
+ */
+  short i;
+
+  if (n == 1) tft_lineSegment(x[0], y[0], x[0], y[0], color);
+  for (i = 1; i < n; i++) {
+    if (i > 1) {
+      skip_x = x[i-1];
+      skip_y = y[i-1];
+      skip_on = 1;
+    }
+    tft_lineSegment(x[i-1], y[i-1], x[i], y[i], color);
+    skip_on = 0;
+  }
+  tft_lineFlush();
+}
+
 // Draw a rectangle
 void tft_drawRect(short x, short y, short w, short h, unsigned short color) {
 /* Draw a rectangle outline with top left vertex (x,y), width w
@@ -274,12 +562,24 @@ void tft_drawRoundRect(short x, short y, short w, short h,
 // Fill a rounded rectangle
 void tft_fillRoundRect(short x, short y, short w,
 				 short h, short r, unsigned short color) {
-  // smarter version
-  tft_fillRect(x+r, y, w-2*r, h, color);
+  const unsigned char *t = tft_circleSpans(r);
+  short k, dx, d = h-2*r-1;
 
-  // draw four corners
-  tft_fillCircleHelper(x+w-r-1, y+r, r, 1, h-2*r-1, color);
-  tft_fillCircleHelper(x+r    , y+r, r, 2, h-2*r-1, color);
+  if (!t) {
+    tft_fillRect(x+r, y, w-2*r, h, color);
+    tft_fillCircleHelper(x+w-r-1, y+r, r, 1, d, color);
+    tft_fillCircleHelper(x+r    , y+r, r, 2, d, color);
+    return;
+  }
+  // the middle, widened by the corner columns that are full height
+  for (k = 0; k < r && t[k+1] == r; k++);
+  tft_fillRect(x+r-k, y, w-2*r+2*k, h, color);
+  // then runs of equal height corner columns, as in tft_fillCircle()
+  for (dx = k+1; dx <= r; dx = k+1) {
+    for (k = dx; k < r && t[k+1] == t[dx]; k++);
+    tft_fillRect(x+w-r-1+dx, y+r-t[dx], k-dx+1, 2*t[dx]+1+d, color);
+    tft_fillRect(x+r-k, y+r-t[dx], k-dx+1, 2*t[dx]+1+d, color);
+  }
 }
 
 // Draw a triangle
@@ -393,18 +693,102 @@ void tft_fillTriangle ( short x0, short y0,
 void tft_drawBitmap(short x, short y,
 			      const unsigned char *bitmap, short w, short h,
 			      unsigned short color) {
+/* Draw the set bits of a 1bpp bitmap, leaving the clear ones alone
+ * Parameters:
+ *      x, y:   top left corner
+ *      bitmap: (w+7)/8 bytes a row, most significant bit on the left
+ *      w, h:   size in pixels
+ *      color:  16-bit color value of the set bits
+ * Returns:     Nothing
+ * Note: each horizontal run of set bits is one line, which the line
+ *  clips. For opaque, multicolor or compressed images see tft_bitmap.h
+ */
+  short i, j, a, j0, sx = x, sy = y, sw = w, sh = h, byteWidth = (w + 7) / 8;
 
-  short i, j, byteWidth = (w + 7) / 8;
-
-  for(j=0; j<h; j++) {
-    for(i=0; i<w; i++ ) {
-      if(pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7))) {
-	tft_drawPixel(x+i, y+j, color);
+  if (!tft_clipRect(&sx, &sy, &sw, &sh)) return;
+  // the visible rows only
+  j0 = sy - tft_org_y - y;
+  for(j = j0; j < j0 + sh; j++) {
+    for(i=0; i<w; ) {
+      if(!(pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7)))) {
+        i++;
+        continue;
       }
+      for (a=i; i<w && (pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7))); i++) ;
+      tft_drawFastHLine(x+a, y+j, i-a, color);
     }
   }
 }
 
+// === bar graphs ===
+// A bar graph is column data: each column is background down to the top
+// of its bar, then bar color. It goes out as one column order window
+// (tft_setAddrWindowCols), with background and bar runs merged across
+// columns, instead of a window per bar or per column.
+static unsigned short bar_color;
+static unsigned long bar_run;
+
+static void tft_barPut(unsigned short c, unsigned long n) {
+  if (!n) return;
+  if ((c != bar_color) && bar_run) {
+    tft_pushRun(bar_color, bar_run);
+    bar_run = 0;
+  }
+  bar_color = c;
+  bar_run += n;
+}
+
+void tft_drawBars(short x, short y, short h, const short *v, short n,
+    short bw, short gap, unsigned short color, unsigned short bg) {
+/* Draw a bar graph: n bars standing on the bottom of an area h high
+ * Parameters:
+ *      x, y:   top left of the area, n*(bw+gap) wide
+ *      h:      height of the area
+ *      v:      bar heights in pixels, cut to 0..h
+ *      n:      number of bars
+ *      bw:     bar width
+ *      gap:    background columns after each bar
+ *      color:  16-bit color of the bars
+ *      bg:     16-bit color of the rest of the area
+ * Returns: Nothing
+ * Note: every pixel of the area is written, so a changing graph needs no
+ *      erase. The visible part goes out as one column order window;
+ *      inside tft_tileBegin() each bar is rectangles instead
+ */
+  short w = n * (bw + gap), sx = x, sy = y, sw = w, sh = h;
+  short c, c0, r0, k, top;
+
+  if ((bw <= 0) || (gap < 0)) return;
+  if (!tft_clipRect(&sx, &sy, &sw, &sh)) return;
+  if (tft_fill_hook) {
+    for (k = 0; k < n; k++) {
+      top = h - ((v[k] < 0) ? 0 : (v[k] > h) ? h : v[k]);
+      tft_fillRect(x + k*(bw+gap), y, bw, top, bg);
+      tft_fillRect(x + k*(bw+gap), y + top, bw, h - top, color);
+      tft_fillRect(x + k*(bw+gap) + bw, y, gap, h, bg);
+    }
+    return;
+  }
+
+  // visible columns c0.. and rows r0.. of the area
+  c0 = sx - tft_org_x - x;
+  r0 = sy - tft_org_y - y;
+  tft_setAddrWindowCols(sx, sy, sx+sw-1, sy+sh-1);
+  for (c = c0; c < c0 + sw; c++) {
+    k = c / (bw + gap);
+    top = h;
+    if (c - k*(bw+gap) < bw)
+      top = h - ((v[k] < 0) ? 0 : (v[k] > h) ? h : v[k]);
+    // rows r0..top-1 background, top..r0+sh-1 bar, as far as visible
+    if (top < r0) top = r0;
+    if (top > r0 + sh) top = r0 + sh;
+    tft_barPut(bg, top - r0);
+    tft_barPut(color, r0 + sh - top);
+  }
+  tft_pushRun(bar_color, bar_run);
+  bar_run = 0;
+}
+
 void tft_write(unsigned char c){
   if (c == '\n') {
     cursor_y += textsize*8;
@@ -417,7 +801,10 @@ void tft_write(unsigned char c){
           cursor_x = new_x;
       }
   } else {
-    tft_drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+    if (textmode == TEXT_CELL)
+      tft_drawCharCells(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+    else
+      tft_drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
     cursor_x += textsize*6;
     if (wrap && (cursor_x > (_width - textsize*6))) {
       cursor_y += textsize*8;
@@ -426,25 +813,125 @@ void tft_write(unsigned char c){
   }
 }
 
+// Draw n glyphs side by side as one address window, streamed pixel row
+// by pixel row with same-colored pixels merged into runs
+static void tft_drawStringSpan(short x, short y, const char *s, short n,
+        unsigned short color, unsigned short bg, unsigned char size) {
+  short w = n * 6 * size, h = 8 * size, r, i, col, sx = x, sy = y;
+  unsigned short run_color = bg, px;
+  unsigned long run = 0;
+  char clip = tft_clipRect(&sx, &sy, &w, &h);
+
+  if (clip == TFT_CLIP_OUT) return;
+  if (clip != TFT_CLIP_IN) {
+    // cut by the clip rectangle: glyph by glyph, each clipped on its own
+    for (i=0; i<n; i++, x += 6*size) tft_drawChar(x, y, s[i], color, bg, size);
+    return;
+  }
+  tft_setAddrWindow(sx, sy, sx+w-1, sy+h-1);
+  for (r=0; r<h; r++) {
+    unsigned char mask = 1 << (r / size);
+    for (i=0; i<n; i++) {
+      const unsigned char *g = font + (unsigned char)s[i] * 5;
+      for (col=0; col<6; col++) {
+        px = (col < 5 && (pgm_read_byte(g+col) & mask)) ? color : bg;
+        if (px != run_color) {
+          if (run) tft_pushRun(run_color, run);
+          run_color = px;
+          run = 0;
+        }
+        run += size;
+      }
+    }
+  }
+  tft_pushRun(run_color, run);
+}
+
+// Draw n transparent glyphs side by side: each horizontal run of set
+// pixels across the whole string is one rectangle
+static void tft_drawStringRuns(short x, short y, const char *s, short n,
+        unsigned short color, unsigned char size) {
+  short j, i, col, x0 = 0, len = 0;
+
+  if (tft_offClip(x, y, n*6*size, 8*size)) return;
+  for (j=0; j<8; j++) {
+    unsigned char mask = 1 << j;
+    for (i=0; i<n; i++) {
+      const unsigned char *g = font + (unsigned char)s[i] * 5;
+      for (col=0; col<6; col++) {
+        if (col < 5 && (pgm_read_byte(g+col) & mask)) {
+          if (!len) x0 = i * 6 + col;
+          len++;
+        } else if (len) {
+          tft_fillRect(x+x0*size, y+j*size, len*size, size, color);
+          len = 0;
+        }
+      }
+    }
+    // the blank sixth column always ends a run before the next row
+  }
+}
+
 inline void tft_writeString(char* str){
 /* Print text onto screen
  * Call tft_setCursor(), tft_setTextColor(), tft_setTextSize()
  *  as necessary before printing
+ * Note: in TEXT_STRING mode each run of glyphs that lands side by side
+ *  on one line, fully inside the clip rectangle, goes out in one piece:
+ *  one address window for opaque text, one rectangle per horizontal run
+ *  of set pixels for transparent text. A run the clip rectangle cuts
+ *  goes glyph by glyph; tabs, newlines, wrapping and glyphs off the
+ *  screen are handled by tft_write() exactly as before.
  */
-    while (*str){
-        tft_write(*str++);
+    char *seg;
+    short x, y, n;
+
+    if (textmode != TEXT_STRING) {
+        while (*str){
+            tft_write(*str++);
+        }
+        return;
+    }
+    while (*str) {
+        seg = str;
+        x = cursor_x;
+        y = cursor_y;
+        n = 0;
+        while (*str && *str != '\n' && *str != '\r' && *str != '\t' &&
+               cursor_x + textsize*6 <= _width &&
+               cursor_y + textsize*8 <= _height) {
+            str++;
+            n++;
+            cursor_x += textsize*6;
+            if (wrap && (cursor_x > (_width - textsize*6))) {
+                cursor_y += textsize*8;
+                cursor_x = 0;
+                break;
+            }
+        }
+        if (!n)
+            tft_write(*str++);
+        else if (textcolor == textbgcolor)
+            tft_drawStringRuns(x, y, seg, n, textcolor, textsize);
+        else if (tft_fill_hook)
+            // tft_fill_hook targets take rectangles only
+            while (n--) {
+                tft_drawChar(x, y, *seg++, textcolor, textbgcolor, textsize);
+                x += textsize*6;
+            }
+        else
+            tft_drawStringSpan(x, y, seg, n, textcolor, textbgcolor, textsize);
     }
 }
 
-// Draw a character
-void tft_drawChar(short x, short y, unsigned char c, unsigned short color, unsigned short bg, unsigned char size) {
-    char i, j;
-  if((x >= _width)            || // Clip right
-     (y >= _height)           || // Clip bottom
-     ((x + 6 * size - 1) < 0) || // Clip left
-     ((y + 8 * size - 1) < 0))   // Clip top
-    return;
+// glyph pixels buffered per burst in tft_drawChar(): a whole glyph at
+// size 1 and 2, a band of whole pixel rows at larger sizes
+#define GLYPH_BUF 192
+static unsigned short glyph_buf[GLYPH_BUF];
 
+// Draw a character one cell at a time, clipping each cell
+void tft_drawCharCells(short x, short y, unsigned char c, unsigned short color, unsigned short bg, unsigned char size) {
+    char i, j;
   for (i=0; i<6; i++ ) {
     unsigned char line;
     if (i == 5)
@@ -470,6 +957,71 @@ void tft_drawChar(short x, short y, unsigned char c, unsigned short color, unsig
   }
 }
 
+// Draw a character
+void tft_drawChar(short x, short y, unsigned char c, unsigned short color, unsigned short bg, unsigned char size) {
+/* Draw a 5x7 glyph from font[] in a 6x8 cell scaled by size
+ * Parameters:
+ *      x, y:  top-left of the cell
+ *      c:     character code
+ *      color: foreground color
+ *      bg:    background color, or the same as color for transparent text
+ *      size:  scale factor, 1 = 6x8 pixels
+ * Returns: Nothing
+ * Note: opaque glyphs go out as one address window streamed in a single
+ *      burst; transparent glyphs as one fillRect per vertical run of set
+ *      pixels in each column. Glyphs cut by the clip rectangle, and glyphs
+ *      drawn while tft_fill_hook is set, fall back to one fillRect per cell.
+ */
+  unsigned char line[5];
+  short i, j, k, w = 6 * size, h = 8 * size, rows, band, sx = x, sy = y;
+  char clip = tft_clipRect(&sx, &sy, &w, &h);
+
+  if (clip == TFT_CLIP_OUT) return;
+  if (tft_fill_hook || (clip != TFT_CLIP_IN) || (w > GLYPH_BUF)) {
+    tft_drawCharCells(x, y, c, color, bg, size);
+    return;
+  }
+
+  for (i=0; i<5; i++)
+    line[i] = pgm_read_byte(font+(c*5)+i);
+
+  if (bg == color) {
+    // transparent: each vertical run of set pixels is one rectangle
+    for (i=0; i<5; i++) {
+      unsigned char bits = line[i];
+      j = 0;
+      while (bits) {
+        if (bits & 1) {
+          for (k = 0; bits & 1; k++, bits >>= 1);
+          tft_fillRect(x+i*size, y+j*size, size, k*size, color);
+          j += k;
+        } else {
+          bits >>= 1;
+          j++;
+        }
+      }
+    }
+    return;
+  }
+
+  // opaque: expand whole pixel rows into glyph_buf, stream them in bands
+  tft_setAddrWindow(sx, sy, sx+w-1, sy+h-1);
+  band = GLYPH_BUF / w;
+  for (j=0; j<h; j+=rows) {
+    unsigned short *p = glyph_buf;
+    rows = (h - j < band) ? h - j : band;
+    for (k=j; k<j+rows; k++) {
+      unsigned char mask = 1 << (k / size);
+      for (i=0; i<6; i++) {
+        unsigned short px = (i < 5 && (line[i] & mask)) ? color : bg;
+        short n;
+        for (n=0; n<size; n++) *p++ = px;
+      }
+    }
+    tft_pushColors(glyph_buf, rows * w);
+  }
+}
+
 inline void tft_setCursor(short x, short y) {
 /* Set cursor for text to be printed
  * Parameters:
@@ -510,6 +1062,14 @@ inline void tft_setTextWrap(char w) {
   wrap = w;
 }
 
+inline void tft_setTextMode(unsigned char m) {
+/* Set how tft_writeString() sends text to the screen
+ * Parameters:
+ *      m = TEXT_STRING (default), TEXT_GLYPH or TEXT_CELL, see tft_gfx.h
+ */
+  textmode = m;
+}
+
 inline unsigned char tft_getRotation(void) {
 /* Returns current roation of screen
  *          0 = no rotation (0 degree rotation)
@@ -529,20 +1089,10 @@ void tft_gfx_setRotation(unsigned char x) {
  *          2 = rotate 180 degree
  *          3 = rotate 90 degree anticlockwise
  * Returns: Nothing
+ * Note: the same as tft_setRotation(), MADCTL included, so the panel and
+ *      the size tft_width()/tft_height() report always agree
  */
-  rotation = (x & 3);
-  switch(rotation) {
-   case 0:
-   case 2:
-    _width  = ILI9340_TFTWIDTH;
-    _height = ILI9340_TFTHEIGHT;
-    break;
-   case 1:
-   case 3:
-    _width  = ILI9340_TFTHEIGHT;;
-    _height = ILI9340_TFTWIDTH;
-    break;
-  }
+  tft_setRotation(x);
 }
 
 // Return the size of the display (per current rotation)
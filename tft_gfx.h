@@ -4,13 +4,22 @@
 
 unsigned short cursor_y, cursor_x, textsize, textcolor, textbgcolor, wrap, rotation;
 
+// tft_writeString() modes, see tft_setTextMode()
+#define TEXT_STRING 0   // runs of glyphs on a line as one window (default)
+#define TEXT_GLYPH  1   // one window per glyph
+#define TEXT_CELL   2   // one fillRect per glyph cell (the old loop)
+unsigned short textmode;
+
 void tft_drawLine(short x0, short y0, short x1, short y1, unsigned short color);
+void tft_drawPolyline(const short *x, const short *y, short n, unsigned short color);
 void tft_drawRect(short x, short y, short w, short h, unsigned short color);
 
 void tft_drawCircle(short x0, short y0, short r, unsigned short color);
 void tft_drawCircleHelper(short x0, short y0, short r, unsigned char cornername,
       unsigned short color);
 void tft_fillCircle(short x0, short y0, short r, unsigned short color);
+void tft_fillCircleBg(short x0, short y0, short r, unsigned short color,
+      unsigned short bg);
 void tft_fillCircleHelper(short x0, short y0, short r, unsigned char cornername,
       short delta, unsigned short color);
 void tft_drawTriangle(short x0, short y0, short x1, short y1,
@@ -21,12 +30,16 @@ void tft_drawRoundRect(short x0, short y0, short w, short h,
       short radius, unsigned short color);
 void tft_fillRoundRect(short x0, short y0, short w, short h, short radius, unsigned short color);
 void tft_drawBitmap(short x, short y, const unsigned char *bitmap, short w, short h, unsigned short color);
+void tft_drawBars(short x, short y, short h, const short *v, short n,
+      short bw, short gap, unsigned short color, unsigned short bg);
 void tft_drawChar(short x, short y, unsigned char c, unsigned short color, unsigned short bg, unsigned char size);
+void tft_drawCharCells(short x, short y, unsigned char c, unsigned short color, unsigned short bg, unsigned char size);
 void tft_setCursor(short x, short y);
 void tft_setTextColor(unsigned short c);
 void tft_setTextColor2(unsigned short c, unsigned short bg);
 void tft_setTextSize(unsigned char s);
 void tft_setTextWrap(char w);
+void tft_setTextMode(unsigned char m);
 void tft_gfx_setRotation(unsigned char r);
 void tft_write(unsigned char c);
 void tft_writeString(char* str);    // This is the function to use to write a string
\ No newline at end of file
@@ -31,12 +31,70 @@ inline void Mode16(void){  // configure SPI1 for 16-bit mode
 }
 
 inline void Mode8(void){  // configure SPI1 for 8-bit mode
-    SPI1CONCLR = 0x400;
+    SPI1CONCLR = 0xC00;
+}
+
+// SPI1 runs with the enhanced buffer, a 128-bit transmit FIFO. D/C, CS and
+// the word width may only change once the FIFO and the shift register are
+// both empty. Read the status register once: SPITBE then SRMT would race
+// with the last word moving from the FIFO into the shift register.
+#define SPI_TBE_SRMT 0x88
+static inline void tft_spiDrain(void) {
+    while ((SPI1STAT & SPI_TBE_SRMT) != SPI_TBE_SRMT);
+}
+
+// tft_drawPixel() leaves CS low and its color word shifting out, so that
+// back to back pixels need no CS toggling and no wait at the end of each
+static char tft_pix_open = 0;
+
+// DMA fill state, see tft_fillRectDMA()
+#define TFT_DMA_IDLE    0
+#define TFT_DMA_RUNNING 1   // blocks still being handed to the DMA
+#define TFT_DMA_DRAIN   2   // last block done, words may still be shifting
+static volatile char tft_dma_state = TFT_DMA_IDLE;
+
+// last address window sent to the panel and the RAMWR write cursor within
+// it (pixels written since RAMWR, modulo the window area), see
+// tft_setAddrWindow(). win_valid=0 forces the next window out in full.
+static unsigned short win_x0, win_x1, win_y0, win_y1;
+static unsigned long win_area, win_offset;
+static char win_valid = 0;
+
+// MADCTL for each rotation, see tft_setRotation()
+static const unsigned char tft_rot_madctl[4] = {
+    ILI9340_MADCTL_MX | ILI9340_MADCTL_BGR,
+    ILI9340_MADCTL_MV | ILI9340_MADCTL_BGR,
+    ILI9340_MADCTL_MY | ILI9340_MADCTL_BGR,
+    ILI9340_MADCTL_MV | ILI9340_MADCTL_MY | ILI9340_MADCTL_MX | ILI9340_MADCTL_BGR
+};
+
+// MADCTL as the panel has it, and as the rotation wants it. A column
+// window (tft_setAddrWindowCols) flips MV in tft_madctl; whatever draws
+// in screen order next flips it back, see tft_madctlRestore()
+static unsigned char tft_madctl = ILI9340_MADCTL_MX | ILI9340_MADCTL_BGR;
+static unsigned char tft_madctl_rot = ILI9340_MADCTL_MX | ILI9340_MADCTL_BGR;
+
+// render target hook, see tft_master.h
+void (*tft_fill_hook)(short x, short y, short w, short h, unsigned short color) = NULL;
+
+
+static void tft_pixClose(void) {
+    tft_spiDrain();
+    _cs_high();
+    tft_pix_open = 0;
+}
+
+// let a running DMA fill or an open pixel stream finish before the next
+// transaction on SPI1
+static inline void tft_sync(void) {
+    if (tft_pix_open) tft_pixClose();
+    if (tft_dma_state != TFT_DMA_IDLE) tft_dmaWait();
 }
 
 void tft_init_hw(void) {
   _width = ILI9340_TFTWIDTH;
   _height = ILI9340_TFTHEIGHT;
+  tft_clipReset();
   RPB11R = 3;              //SDO pin for SPI - goes to MOSI on TFT
   //RPA1R = 3; // SDO pin for SPI - goes to MOSI on TFT
   //PPSOutput(2, RPA1, SDO1);
@@ -46,7 +104,7 @@ void tft_init_hw(void) {
 void tft_spiwrite(unsigned char c){ // Transfer to SPI
     while (TxBufFullSPI1());
     WriteSPI1(c);
-    while (SPI1STATbits.SPIBUSY); // wait for it to end of transaction
+    tft_spiDrain(); // wait for it to end of transaction
 }
 
 void tft_spiwrite8(unsigned char c) {   // Transfer one byte c to SPI
@@ -59,28 +117,48 @@ void tft_spiwrite8(unsigned char c) {   // Transfer one byte c to SPI
     Mode8(); // switch to 8-bit mode
     while (TxBufFullSPI1());
     WriteSPI1(c);
-    while (SPI1STATbits.SPIBUSY); // wait for it to end of transaction
+    tft_spiDrain(); // wait for it to end of transaction
     Mode16(); // switch back to 16-bit mode
 }
 
 void tft_spiwrite16(unsigned short c){  // Transfer two bytes "c" to SPI
     while (TxBufFullSPI1());
     WriteSPI1(c);
-    while (SPI1STATbits.SPIBUSY); // wait for it to end of transaction
+    tft_spiDrain(); // wait for it to end of transaction
 }
 
+// Send one command byte (D/C low, CS low already) in 8-bit mode, see
+// TFT_SPI_WIDTH in tft_master.h
+static inline void tft_spicommand(unsigned char c) {
+    tft_spiwrite8(c);
+}
+
+// Stream n pixels of color c into the open window: keep the FIFO topped
+// up and only wait for the bus to drain once, at the end
+static void tft_spiRepeat16(unsigned short c, long n) {
+    if (n > 0 && win_area) win_offset = (win_offset + n) % win_area;
+    while (n-- > 0) {
+        while (TxBufFullSPI1());
+        WriteSPI1(c);
+    }
+    tft_spiDrain();
+}
 
 void tft_writecommand(unsigned char c) {
+    tft_sync();
+    win_valid = 0; // could be anything, e.g. CASET or MADCTL
     _dc_low();
     _cs_low();
 
-    tft_spiwrite8(c);
+    tft_spicommand(c);
 
     _cs_high();
 
 }
 
 void tft_writecommand16(unsigned short c) {
+    tft_sync();
+    win_valid = 0; // as tft_writecommand()
     _dc_low();
     _cs_low();
 
@@ -92,6 +170,8 @@ void tft_writecommand16(unsigned short c) {
 
 
 void tft_writedata(unsigned char c) {
+    tft_sync();
+    win_valid = 0;
     _dc_high();
     _cs_low();
 
@@ -102,6 +182,8 @@ void tft_writedata(unsigned char c) {
 }
 
 void tft_writedata16(unsigned short c) {
+    tft_sync();
+    win_valid = 0; // may move the RAMWR cursor
     _dc_high();
     _cs_low();
 
@@ -116,7 +198,36 @@ void tft_writedata16(unsigned short c) {
 // stored in PROGMEM.  The table may look bulky, but that's mostly the
 // formatting -- storage-wise this is hundreds of bytes more compact
 // than the equivalent code.  Companion function follows.
-#define DELAY 0x80
+// (table layout and DELAY: see "command lists" in tft_master.h)
+static const unsigned char tft_initcmd[] = {
+  21,                                   // 21 commands in list:
+  0xEF, 3, 0x03, 0x80, 0x02,
+  0xCF, 3, 0x00, 0xC1, 0x30,
+  0xED, 4, 0x64, 0x03, 0x12, 0x81,
+  0xE8, 3, 0x85, 0x00, 0x78,
+  0xCB, 5, 0x39, 0x2C, 0x00, 0x34, 0x02,
+  0xF7, 1, 0x20,
+  0xEA, 2, 0x00, 0x00,
+  ILI9340_PWCTR1, 1, 0x23,              //Power control: VRH[5:0]
+  ILI9340_PWCTR2, 1, 0x10,              //Power control: SAP[2:0];BT[3:0]
+  ILI9340_VMCTR1, 2, 0x3e, 0x28,        //VCM control
+  ILI9340_VMCTR2, 1, 0x86,              //VCM control2
+  ILI9340_MADCTL, 1,                    // Memory Access Control
+    ILI9340_MADCTL_MX | ILI9340_MADCTL_BGR,
+  ILI9340_PIXFMT, 1, 0x55,
+  ILI9340_FRMCTR1, 2, 0x00, 0x18,
+  ILI9340_DFUNCTR, 3, 0x08, 0x82, 0x27, // Display Function Control
+  0xF2, 1, 0x00,                        // 3Gamma Function Disable
+  ILI9340_GAMMASET, 1, 0x01,            //Gamma curve selected
+  ILI9340_GMCTRP1, 15,                  //Set Gamma
+    0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1,
+    0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00,
+  ILI9340_GMCTRN1, 15,                  //Set Gamma
+    0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1,
+    0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F,
+  ILI9340_SLPOUT, DELAY, 120,           //Exit Sleep
+  ILI9340_DISPON, 0,                    //Display on
+};
 
 void tft_begin(void) {
 
@@ -133,6 +244,11 @@ void tft_begin(void) {
 
     // Start with 8-bit mode for initialization - move to 16-bit mode once
     // that's done
+    // ENHBUF can only be changed with the module off. Transmit interrupt
+    // (and so the DMA trigger) while the FIFO is not full: STXISEL = 11
+    SPI1CONCLR = 0x8000;
+    SPI1CONSET = 0x1000C;
+    SPI1CONSET = 0x8000;
 
   _rst_high();
   delay_ms(5);
@@ -141,255 +257,378 @@ void tft_begin(void) {
   _rst_high();
   delay_ms(150);
 
-  tft_writecommand(0xEF);
-  tft_writedata(0x03);
-  tft_writedata(0x80);
-  tft_writedata(0x02);
-
-  tft_writecommand(0xCF);
-  tft_writedata(0x00);
-  tft_writedata(0xC1);
-  tft_writedata(0x30);
-
-  tft_writecommand(0xED);
-  tft_writedata(0x64);
-  tft_writedata(0x03);
-  tft_writedata(0x12);
-  tft_writedata(0x81);
-
-  tft_writecommand(0xE8);
-  tft_writedata(0x85);
-  tft_writedata(0x00);
-  tft_writedata(0x78);
-
-  tft_writecommand(0xCB);
-  tft_writedata(0x39);
-  tft_writedata(0x2C);
-  tft_writedata(0x00);
-  tft_writedata(0x34);
-  tft_writedata(0x02);
-
-  tft_writecommand(0xF7);
-  tft_writedata(0x20);
-
-  tft_writecommand(0xEA);
-  tft_writedata(0x00);
-  tft_writedata(0x00);
-
-  tft_writecommand(ILI9340_PWCTR1);    //Power control
-  tft_writedata(0x23);   //VRH[5:0]
-
-  tft_writecommand(ILI9340_PWCTR2);    //Power control
-  tft_writedata(0x10);   //SAP[2:0];BT[3:0]
-
-  tft_writecommand(ILI9340_VMCTR1);    //VCM control
-  tft_writedata(0x3e);
-  tft_writedata(0x28);
-
-  tft_writecommand(ILI9340_VMCTR2);    //VCM control2
-  tft_writedata(0x86);
-
-  tft_writecommand(ILI9340_MADCTL);    // Memory Access Control
-  tft_writedata(ILI9340_MADCTL_MX | ILI9340_MADCTL_BGR);
-
-  tft_writecommand(ILI9340_PIXFMT);
-  tft_writedata(0x55);
-
-  tft_writecommand(ILI9340_FRMCTR1);
-  tft_writedata(0x00);
-  tft_writedata(0x18);
-
-  tft_writecommand(ILI9340_DFUNCTR);    // Display Function Control
-  tft_writedata(0x08);
-  tft_writedata(0x82);
-  tft_writedata(0x27);
-
-  tft_writecommand(0xF2);    // 3Gamma Function Disable
-  tft_writedata(0x00);
-
-  tft_writecommand(ILI9340_GAMMASET);    //Gamma curve selected
-  tft_writedata(0x01);
-
-  tft_writecommand(ILI9340_GMCTRP1);    //Set Gamma
-  tft_writedata(0x0F);
-  tft_writedata(0x31);
-  tft_writedata(0x2B);
-  tft_writedata(0x0C);
-  tft_writedata(0x0E);
-  tft_writedata(0x08);
-  tft_writedata(0x4E);
-  tft_writedata(0xF1);
-  tft_writedata(0x37);
-  tft_writedata(0x07);
-  tft_writedata(0x10);
-  tft_writedata(0x03);
-  tft_writedata(0x0E);
-  tft_writedata(0x09);
-  tft_writedata(0x00);
-
-  tft_writecommand(ILI9340_GMCTRN1);    //Set Gamma
-  tft_writedata(0x00);
-  tft_writedata(0x0E);
-  tft_writedata(0x14);
-  tft_writedata(0x03);
-  tft_writedata(0x11);
-  tft_writedata(0x07);
-  tft_writedata(0x31);
-  tft_writedata(0xC1);
-  tft_writedata(0x48);
-  tft_writedata(0x08);
-  tft_writedata(0x0F);
-  tft_writedata(0x0C);
-  tft_writedata(0x31);
-  tft_writedata(0x36);
-  tft_writedata(0x0F);
-
-  tft_writecommand(ILI9340_SLPOUT);    //Exit Sleep
-  delay_ms(120);
-  tft_writecommand(ILI9340_DISPON);    //Display on
+  tft_commandList(tft_initcmd);
+  // the list leaves the panel at rotation 0
+  tft_madctl = tft_madctl_rot = tft_rot_madctl[0];
+  rotation = 0;
+  _width = ILI9340_TFTWIDTH;
+  _height = ILI9340_TFTHEIGHT;
+  tft_clipReset();
 
   // Now move to 16-bit mode to speed things up for display
   Mode16();
 }
 
 
-void tft_setAddrWindow(unsigned short x0, unsigned short y0, unsigned short x1, unsigned short y1) {
+// command and data writes that leave the window cache alone, for
+// tft_setAddrWindow() and the scroll commands
+static void tft_wincommand(unsigned char c) {
+    _dc_low();
+    _cs_low();
+    tft_spicommand(c);
+    _cs_high();
+}
 
-  tft_writecommand(ILI9340_CASET); // Column addr set
-  tft_writedata16(x0);
-  tft_writedata16(x1);
+// the start and end argument pair of CASET/PASET
+static void tft_winargs(unsigned short a, unsigned short b) {
+    _dc_high();
+    _cs_low();
+    // the bus is drained: the FIFO holds both without a TBF check
+    WriteSPI1(a);
+    WriteSPI1(b);
+    tft_spiDrain();
+    _cs_high();
+}
 
-  tft_writecommand(ILI9340_PASET); // Row addr set
-  tft_writedata16(y0);
-  tft_writedata16(y1);
+static void tft_windata16(unsigned short c) {
+    _dc_high();
+    _cs_low();
+    tft_spiwrite16(c);
+    _cs_high();
+}
 
-  tft_writecommand(ILI9340_RAMWR); // write to RAM
+// send MADCTL m, unless the panel has it already. The cached window was
+// in the old orientation's terms, so it goes
+static void tft_madctlSet(unsigned char m) {
+  if (m == tft_madctl) return;
+  tft_sync();
+  tft_wincommand(ILI9340_MADCTL);
+  _dc_high();
+  _cs_low();
+  tft_spiwrite8(m);
+  _cs_high();
+  tft_madctl = m;
+  win_valid = 0;
+  tft_madctl_switches++;
+}
+
+// back to the rotation's MADCTL after a column window
+static inline void tft_madctlRestore(void) {
+  if (tft_madctl != tft_madctl_rot) tft_madctlSet(tft_madctl_rot);
+}
+
+// CASET c0..c1, PASET p0..p1 and RAMWR, each left out when the panel has
+// it already
+static void tft_window(unsigned short x0, unsigned short y0,
+    unsigned short x1, unsigned short y1) {
+  char reuse = win_valid;
+
+  tft_sync();
+
+  if (!win_valid || x0 != win_x0 || x1 != win_x1) {
+    tft_wincommand(ILI9340_CASET); // Column addr set
+    tft_winargs(x0, x1);
+    win_x0 = x0;
+    win_x1 = x1;
+    tft_win_sent += 5;
+    reuse = 0;
+  }
+  else tft_win_elided += 5;
+
+  if (!win_valid || y0 != win_y0 || y1 != win_y1) {
+    tft_wincommand(ILI9340_PASET); // Row addr set
+    tft_winargs(y0, y1);
+    win_y0 = y0;
+    win_y1 = y1;
+    tft_win_sent += 5;
+    reuse = 0;
+  }
+  else tft_win_elided += 5;
+
+  if (!reuse || win_offset) {
+    tft_wincommand(ILI9340_RAMWR); // write to RAM
+    tft_win_sent++;
+  }
+  else tft_win_elided++;
+
+  win_area = (unsigned long)(x1 - x0 + 1) * (y1 - y0 + 1);
+  win_offset = 0;
+  win_valid = 1;
+}
+
+void tft_setAddrWindow(unsigned short x0, unsigned short y0, unsigned short x1, unsigned short y1) {
+/* Open the address window (x0,y0)-(x1,y1) for the pixels that follow
+ * Note: the window last sent and the RAMWR cursor are cached. CASET
+ *      (or PASET) is skipped when the columns (or rows) are unchanged,
+ *      and RAMWR too when the cursor already sits at the window start,
+ *      e.g. after a previous primitive filled the same window.
+ *      Skipped bytes are counted in tft_win_elided, sent ones in tft_win_sent
+ */
+  tft_madctlRestore();
+  tft_window(x0, y0, x1, y1);
+}
+
+void tft_setAddrWindowCols(unsigned short x0, unsigned short y0, unsigned short x1, unsigned short y1) {
+/* Open the address window (x0,y0)-(x1,y1) for pixels that follow column
+ *  by column: down column x0, then down column x0+1, and so on
+ * Note: MADCTL gets MV flipped, which swaps the panel's column and page
+ *      addresses whatever the rotation. The next row order window, pixel
+ *      or command list flips it back, so column windows back to back pay
+ *      for MADCTL once. Window caching as tft_setAddrWindow()
+ */
+  tft_madctlSet(tft_madctl_rot ^ ILI9340_MADCTL_MV);
+  tft_window(y0, x0, y1, x1);
 }
 
 
 void tft_pushColor(unsigned short color) {
+  tft_sync();
   _dc_high();
   _cs_low();
 
   tft_spiwrite16(color);
 
   _cs_high();
+  // one step along the window, wrapping to its start like the panel does
+  if (++win_offset >= win_area) win_offset = 0;
 }
-#define NOP asm("nop");
-#define wait16 NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;
-#define wait8 NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;
-#define wait12 NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;
-#define wait15 NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;NOP;
 
-void tft_drawPixel(short x, short y, unsigned short color) {
-/* Draw a pixel at location (x,y) with given color
+void tft_pushColors(const unsigned short *colors, unsigned short n) {
+/* Continue the current RAMWR stream with n pixels from a buffer
  * Parameters:
- *      x:  x-coordinate of pixel to draw; top left of screen is x=0
- *              and x increases to the right
- *      y:  y-coordinate of pixel to draw; top left of screen is y=0
- *              and y increases to the bottom
- *      color:  16-bit color value
+ *      colors: 16-bit color values, in window order
+ *      n:      number of pixels
  * Returns:     Nothing
+ * Note: call tft_setAddrWindow() first. The FIFO is kept full and the
+ *      bus is drained only once at the end
  */
-
-  if((x < 0) ||(x >= _width) || (y < 0) || (y >= _height)) return;
-/*
-  tft_setAddrWindow(x,y,x+1,y+1);
-
+  tft_sync();
   _dc_high();
   _cs_low();
 
-  tft_spiwrite16(color);
+  if (win_area) win_offset = (win_offset + n) % win_area;
+  while (n--) {
+      while (TxBufFullSPI1());
+      WriteSPI1(*colors++);
+  }
+  tft_spiDrain();
 
   _cs_high();
 }
-*/
-  //tft_writecommand(ILI9340_CASET); // Column addr set
-   _dc_low();
-    _cs_low();
-    //tft_spiwrite8(ILI9340_CASET);
-    Mode8(); // switch to 8-bit mode
-    while (TxBufFullSPI1());
-    WriteSPI1(ILI9340_CASET);
-    //while (SPI1STATbits.SPIBUSY); // wait for it to end of transaction
-    wait16;
-    Mode16(); // switch back to 16-bit mode
-    _cs_high();
 
-  //tft_writedata16(x);
-   _dc_high();
+void tft_pushRun(unsigned short color, unsigned long n) {
+/* Continue the current RAMWR stream with n pixels of one color
+ * Parameters:
+ *      color:  16-bit color value
+ *      n:      number of pixels
+ * Returns:     Nothing
+ * Note: call tft_setAddrWindow() first. Like tft_drawPixel(), the stream
+ *      is left open with the last words still shifting, so back to back
+ *      runs keep the FIFO full; the next other tft_ call closes it
+ */
+  if (!tft_pix_open) {
+    tft_sync();
+    _dc_high();
     _cs_low();
-    //tft_spiwrite16(c);
-   // while (TxBufFullSPI1());
-    WriteSPI1(x);
-    //while (SPI1STATbits.SPIBUSY);
-    wait16;wait16;wait8;
-    _cs_high();
+    tft_pix_open = 1;
+  }
 
-    
-  //tft_writedata16(x+1);
-  // _dc_high();
-    _cs_low();
-    //tft_spiwrite16(c);
-    //while (TxBufFullSPI1());
-    WriteSPI1(x+1);
-    //while (SPI1STATbits.SPIBUSY);
-    wait16;wait16;wait8;
-    _cs_high();
+  if (win_area) win_offset = (win_offset + n) % win_area;
+  while (n--) {
+      while (TxBufFullSPI1());
+      WriteSPI1(color);
+  }
+}
 
-  //t_writecommand(ILI9340_PASET); // Row addr set
-  _dc_low();
-    _cs_low();
-    //tft_spiwrite8(ILI9340_PASET);
-    Mode8(); // switch to 8-bit mode
-    //while (TxBufFullSPI1());
-    WriteSPI1(ILI9340_PASET);
-    //while (SPI1STATbits.SPIBUSY); // wait for it to end of transaction
-    wait16;wait8;
-    Mode16(); // switch back to 16-bit mode
-    _cs_high();
+// one command byte inside the pixel stream: D/C and the word width only
+// flip once everything queued before has left the shift register
+static void tft_pixCommand(unsigned char c) {
+    tft_spiDrain();
+    _dc_low();
+    Mode8();
+    WriteSPI1(c);
+    tft_spiDrain();
+    Mode16();
+    _dc_high();
+}
 
-  //tft_writedata16(y);
-   _dc_high();
-    _cs_low();
-    //tft_spiwrite16(c);
-   // while (TxBufFullSPI1());
-    WriteSPI1(y);
-   // while (SPI1STATbits.SPIBUSY);
-    wait16;wait16;wait8;
-    _cs_high();
+// === clipping ===
+// The current origin and clip rectangle live in tft_org_x/y and
+// tft_clip_x0..y1 (screen coordinates, see tft_master.h); each push saves
+// them here first.
+struct tft_clip_state {
+    short org_x, org_y, x0, y0, x1, y1;
+};
+static struct tft_clip_state clip_stack[TFT_CLIP_DEPTH];
+static unsigned char clip_depth = 0;    // pushes, kept or not
+
+void tft_clipReset(void) {
+/* Drop every clip and viewport push: the origin goes back to the top
+ * left of the screen and the clip rectangle to the whole screen
+ * Returns:     Nothing
+ */
+    clip_depth = 0;
+    tft_org_x = tft_org_y = 0;
+    tft_clip_x0 = tft_clip_y0 = 0;
+    tft_clip_x1 = _width;
+    tft_clip_y1 = _height;
+}
 
-    
-  //tft_writedata16(y+1);
-   //_dc_high();
-    _cs_low();
-    //tft_spiwrite16(c);
-    //while (TxBufFullSPI1());
-    WriteSPI1(y+1);
-    //while (SPI1STATbits.SPIBUSY);
-    wait16;wait16;wait8;
-    _cs_high();
+void tft_clipPush(short x, short y, short w, short h) {
+/* Narrow the clip rectangle to its overlap with a rectangle
+ * Parameters:
+ *      x, y:   top left of the rectangle, relative to the origin
+ *      w, h:   size of the rectangle
+ * Returns:     Nothing
+ * Note: undo with tft_clipPop(). Past TFT_CLIP_DEPTH pushes the clip
+ *      rectangle is left as it is (and the matching pops do nothing)
+ */
+    struct tft_clip_state *s;
+
+    if (clip_depth++ >= TFT_CLIP_DEPTH) return;
+    s = &clip_stack[clip_depth - 1];
+    s->org_x = tft_org_x;
+    s->org_y = tft_org_y;
+    s->x0 = tft_clip_x0;
+    s->y0 = tft_clip_y0;
+    s->x1 = tft_clip_x1;
+    s->y1 = tft_clip_y1;
+    x += tft_org_x;
+    y += tft_org_y;
+    if (x > tft_clip_x0) tft_clip_x0 = x;
+    if (y > tft_clip_y0) tft_clip_y0 = y;
+    if (x + w < tft_clip_x1) tft_clip_x1 = x + w;
+    if (y + h < tft_clip_y1) tft_clip_y1 = y + h;
+    // an empty rectangle stays empty: every primitive is rejected
+    if (tft_clip_x1 < tft_clip_x0) tft_clip_x1 = tft_clip_x0;
+    if (tft_clip_y1 < tft_clip_y0) tft_clip_y1 = tft_clip_y0;
+}
 
-  //tft_writecommand(ILI9340_RAMWR); // write to RAM
-    _dc_low();
+void tft_viewportPush(short x, short y, short w, short h) {
+/* Clip to a rectangle, as tft_clipPush(), and move the origin to its top
+ * left corner
+ * Parameters:
+ *      x, y:   top left of the viewport, relative to the current origin
+ *      w, h:   size of the viewport
+ * Returns:     Nothing
+ * Note: undo with tft_clipPop()
+ */
+    char kept = clip_depth < TFT_CLIP_DEPTH;
+
+    tft_clipPush(x, y, w, h);
+    if (!kept) return;
+    tft_org_x += x;
+    tft_org_y += y;
+}
+
+void tft_clipPop(void) {
+/* Undo the last tft_clipPush() or tft_viewportPush()
+ * Returns:     Nothing
+ */
+    struct tft_clip_state *s;
+
+    if (!clip_depth) return;
+    if (clip_depth-- > TFT_CLIP_DEPTH) return;
+    s = &clip_stack[clip_depth];
+    tft_org_x = s->org_x;
+    tft_org_y = s->org_y;
+    tft_clip_x0 = s->x0;
+    tft_clip_y0 = s->y0;
+    tft_clip_x1 = s->x1;
+    tft_clip_y1 = s->y1;
+}
+
+char tft_clipRect(short *x, short *y, short *w, short *h) {
+/* Move a rectangle to screen coordinates and cut it to the clip rectangle
+ * Parameters:
+ *      x, y:   top left, relative to the origin; set to screen coordinates
+ *      w, h:   size; set to the size of what is left
+ * Returns:     TFT_CLIP_OUT, TFT_CLIP_PART or TFT_CLIP_IN
+ * Note: how the primitives clip. Code that streams its own address window
+ *      uses it to find the part of the window to send
+ */
+    short x0 = *x + tft_org_x, y0 = *y + tft_org_y;
+    short x1 = x0 + *w, y1 = y0 + *h;
+    char in = TFT_CLIP_IN;
+
+    if (x0 < tft_clip_x0) { x0 = tft_clip_x0; in = TFT_CLIP_PART; }
+    if (y0 < tft_clip_y0) { y0 = tft_clip_y0; in = TFT_CLIP_PART; }
+    if (x1 > tft_clip_x1) { x1 = tft_clip_x1; in = TFT_CLIP_PART; }
+    if (y1 > tft_clip_y1) { y1 = tft_clip_y1; in = TFT_CLIP_PART; }
+    if ((x0 >= x1) || (y0 >= y1)) return TFT_CLIP_OUT;
+    *x = x0;
+    *y = y0;
+    *w = x1 - x0;
+    *h = y1 - y0;
+    return in;
+}
+
+void tft_drawPixel(short x, short y, unsigned short color) {
+/* Draw a pixel at location (x,y) with given color
+ * Parameters:
+ *      x:  x-coordinate of pixel to draw; top left of screen is x=0
+ *              and x increases to the right
+ *      y:  y-coordinate of pixel to draw; top left of screen is y=0
+ *              and y increases to the bottom
+ *      color:  16-bit color value
+ * Returns:     Nothing
+ * Note: argument and color words are queued in the SPI1 FIFO and the
+ *      waits poll the status register, so no timing depends on
+ *      SPI_freq or sys_clock. The color word is still shifting out on
+ *      return; the next pixel (or any other tft_ call) waits for it.
+ */
+  char reuse;
+
+  x += tft_org_x;
+  y += tft_org_y;
+  if ((x < tft_clip_x0) || (x >= tft_clip_x1) ||
+      (y < tft_clip_y0) || (y >= tft_clip_y1)) return;
+  if (tft_fill_hook) { tft_fill_hook(x, y, 1, 1, color); return; }
+  tft_madctlRestore();
+  if (!tft_pix_open) {
+    if (tft_dma_state != TFT_DMA_IDLE) tft_dmaWait();
+    // the bus is idle here: every other path drains before returning
+    _dc_high();
     _cs_low();
-    //tft_spiwrite8(ILI9340_RAMWR);
-    Mode8(); // switch to 8-bit mode
-   // while (TxBufFullSPI1());
-    WriteSPI1(ILI9340_RAMWR);
-   // while (SPI1STATbits.SPIBUSY); // wait for it to end of transaction
-    wait16;wait8;
-    Mode16(); // switch back to 16-bit mode
-    _cs_high();
+    tft_pix_open = 1;
+  }
 
-  _dc_high();
-  _cs_low();
-  //tft_spiwrite16(color);
- // while (TxBufFullSPI1());
-    WriteSPI1(color);
-    //while (SPI1STATbits.SPIBUSY);
-    wait16;wait16;wait8;
-  _cs_high();
+  // 1x1 window, so the cursor is back at its start after every pixel and
+  // a repeated column (or row) needs no CASET (or PASET) at all
+  reuse = win_valid;
+  if (!win_valid || x != win_x0 || x != win_x1) {
+    tft_pixCommand(ILI9340_CASET); // Column addr set
+    // at most two words after a drain: the FIFO holds them, no TBF check
+    WriteSPI1(x);
+    WriteSPI1(x);
+    win_x0 = win_x1 = x;
+    tft_win_sent += 5;
+    reuse = 0;
+  }
+  else tft_win_elided += 5;
+
+  if (!win_valid || y != win_y0 || y != win_y1) {
+    tft_pixCommand(ILI9340_PASET); // Row addr set
+    WriteSPI1(y);
+    WriteSPI1(y);
+    win_y0 = win_y1 = y;
+    tft_win_sent += 5;
+    reuse = 0;
+  }
+  else tft_win_elided += 5;
+
+  if (!reuse || win_offset) {
+    tft_pixCommand(ILI9340_RAMWR); // write to RAM
+    tft_win_sent++;
+  }
+  else tft_win_elided++;
+  win_area = 1;
+  win_offset = 0;
+  win_valid = 1;
+
+  // with nothing to send above, the previous color may still be queued
+  while (SPI1STATbits.SPITBF);
+  WriteSPI1(color);
 }
 
 void tft_drawFastVLine(short x, short y, short h, unsigned short color) {
@@ -403,21 +642,17 @@ void tft_drawFastVLine(short x, short y, short h, unsigned short color) {
  *      color:  16-bit color value
  * Returns:     Nothing
  */
+  short w = 1;
 
-  // Rudimentary clipping
-  if((x >= _width) || (y >= _height)) return;
-
-  if((y+h-1) >= _height)
-    h = _height-y;
+  if (!tft_clipRect(&x, &y, &w, &h)) return;
+  if (tft_fill_hook) { tft_fill_hook(x, y, 1, h, color); return; }
 
   tft_setAddrWindow(x, y, x, y+h-1);
 
   _dc_high();
   _cs_low();
 
-  while (h--) {
-      tft_spiwrite16(color);
-  }
+  tft_spiRepeat16(color, h);
 
   _cs_high();
 }
@@ -434,18 +669,17 @@ void tft_drawFastHLine(short x, short y, short w, unsigned short color) {
  *      color:  16-bit color value
  * Returns:     Nothing
  */
+  short h = 1;
+
+  if (!tft_clipRect(&x, &y, &w, &h)) return;
+  if (tft_fill_hook) { tft_fill_hook(x, y, w, 1, color); return; }
 
-  // Rudimentary clipping
-  if((x >= _width) || (y >= _height)) return;
-  if((x+w-1) >= _width)  w = _width-x;
   tft_setAddrWindow(x, y, x+w-1, y);
 
   _dc_high();
   _cs_low();
 
-  while (w--) {
-      tft_spiwrite16(color);
-  }
+  tft_spiRepeat16(color, w);
 
   _cs_high();
 }
@@ -455,6 +689,7 @@ void tft_fillScreen(unsigned short color) {
  * Parameters:
  *      color: 16-bit color value
  * Returs:  Nothing
+ * Note: inside a viewport or clip push, fills just the clip rectangle
  */
     tft_fillRect(0, 0,  _width, _height, color);
 }
@@ -475,23 +710,300 @@ void tft_fillRect(short x, short y, short w, short h,
  * Returns:     Nothing
  */
 
-  // rudimentary clipping (drawChar w/big text requires this)
-  if((x >= _width) || (y >= _height)) return;
-  if((x + w - 1) >= _width)  w = _width  - x;
-  if((y + h - 1) >= _height) h = _height - y;
+  if (!tft_clipRect(&x, &y, &w, &h)) return;
+  if (tft_fill_hook) { tft_fill_hook(x, y, w, h, color); return; }
 
   tft_setAddrWindow(x, y, x+w-1, y+h-1);
 
   _dc_high();
   _cs_low();
 
-  for(y=h; y>0; y--) {
-    for(x=w; x>0; x--) {
-        tft_spiwrite16(color);
+  tft_spiRepeat16(color, (long)w * h);
+
+  _cs_high();
+}
+
+// === DMA fill ===
+// The DMA block ends after max(source size, destination size) bytes and the
+// destination is the 2-byte SPI1BUF, so one block can carry no more pixels
+// than the source holds. The color is therefore replicated into a small
+// pattern buffer and the DMA2 block-done interrupt chains blocks until the
+// whole area has been sent. A buffer stream (tft_pushColorsDMA) chains
+// blocks the same way, moving the source along instead.
+static unsigned short tft_dma_pattern[TFT_DMA_BLOCK];
+static unsigned short tft_dma_color;
+static short tft_dma_filled = 0;             // valid entries in tft_dma_pattern
+static volatile unsigned int tft_dma_left;  // pixels not yet handed to the DMA
+static const unsigned short *tft_dma_src;   // where the next block starts
+static unsigned int tft_dma_chunk;          // most pixels in one block
+static char tft_dma_stream;                 // source moves on after a block
+static char tft_dma_ready = 0;
+
+static void tft_dmaInit(void) {
+    DmaChnOpen(TFT_DMA_CHN, DMA_CHN_PRI3, DMA_OPEN_DEFAULT);
+    // move one 16-bit cell each time the SPI1 transmit buffer empties
+    DmaChnSetEventControl(TFT_DMA_CHN, DMA_EV_START_IRQ_EN | DMA_EV_START_IRQ(_SPI1_TX_IRQ));
+    DmaChnSetEvEnableFlags(TFT_DMA_CHN, DMA_EV_BLOCK_DONE);
+    INTSetVectorPriority(TFT_DMA_VECTOR, INT_PRIORITY_LEVEL_5);
+    INTClearFlag(TFT_DMA_INT);
+    INTEnable(TFT_DMA_INT, INT_ENABLED);
+    tft_dma_ready = 1;
+}
+
+static void tft_dmaNextBlock(void) {
+    unsigned int n = tft_dma_left;
+    const unsigned short *src = tft_dma_src;
+    if (n > tft_dma_chunk) n = tft_dma_chunk;
+    tft_dma_left -= n;
+    if (tft_dma_stream) tft_dma_src += n;
+    DmaChnSetTxfer(TFT_DMA_CHN, src, (void*)&SPI1BUF, n*2, 2, 2);
+    DmaChnEnable(TFT_DMA_CHN);
+}
+
+// block chaining: hand the next block to the DMA as soon as one finishes
+void __ISR(_DMA_2_VECTOR, ipl5) DMA2Handler(void)
+{
+    DmaChnClrEvFlags(TFT_DMA_CHN, DMA_EV_BLOCK_DONE);
+    INTClearFlag(TFT_DMA_INT);
+    if (tft_dma_left) tft_dmaNextBlock();
+    else tft_dma_state = TFT_DMA_DRAIN;
+}
+
+char tft_dmaBusy(void) {
+/* Poll the DMA fill started by tft_fillRectDMA(), or the stream started
+ *  by tft_pushColorsDMA()
+ * Returns: nonzero while the fill is still running
+ * Note: releases CS once the last word has left the shift register, so
+ *      it must be polled (directly, via tft_dmaWait() or PT_TFT_DMA_WAIT)
+ *      for the fill to complete
+ */
+    if (tft_dma_state == TFT_DMA_DRAIN &&
+        (SPI1STAT & SPI_TBE_SRMT) == SPI_TBE_SRMT) {
+        _cs_high();
+        tft_dma_state = TFT_DMA_IDLE;
     }
+    return tft_dma_state != TFT_DMA_IDLE;
+}
+
+void tft_dmaWait(void) {
+    while (tft_dmaBusy());
+}
+
+// hand n pixels (whole cells, see below) to the DMA, into the open window
+static void tft_dmaStart(unsigned int n) {
+  tft_dma_left = n;
+  tft_dma_state = TFT_DMA_RUNNING;
+  _dc_high();
+  _cs_low();
+  tft_dmaNextBlock();
+}
+
+// start streaming n pixels of one color into the open window
+static void tft_dmaFill(unsigned short color, unsigned int n) {
+  short k;
+
+  if (!tft_dma_ready) tft_dmaInit();
+  // only (re)build as much of the pattern as this fill can use
+  k = (n > TFT_DMA_BLOCK) ? TFT_DMA_BLOCK : n;
+  if (color != tft_dma_color) tft_dma_filled = 0;
+  while (tft_dma_filled < k) tft_dma_pattern[tft_dma_filled++] = color;
+  tft_dma_color = color;
+
+  tft_dma_src = tft_dma_pattern;
+  tft_dma_chunk = TFT_DMA_BLOCK;
+  tft_dma_stream = 0;
+  tft_dmaStart(n);
+}
+
+void tft_pushColorsDMA(const unsigned short *colors, unsigned long n) {
+/* Continue the current RAMWR stream with n pixels from a buffer, sent by
+ *  the DMA, and return immediately
+ * Parameters:
+ *      colors: 16-bit color values, in window order (but see the note)
+ *      n:      number of pixels
+ * Returns:     Nothing
+ * Note: call tft_setAddrWindow() first, and leave the buffer alone until
+ *      tft_dmaBusy() is 0 (PT_TFT_DMA_WAIT)
+ */
+  if (!n) return;
+  if (!tft_dma_ready) tft_dmaInit();
+  tft_sync();
+  if (win_area) win_offset = (win_offset + n) % win_area;
+  tft_dma_src = colors;
+  tft_dma_chunk = TFT_DMA_STREAM_BLOCK;
+  tft_dma_stream = 1;
+  tft_dmaStart(n);
+}
+
+void tft_fillRectDMA(short x, short y, short w, short h, unsigned short color) {
+/* Start a DMA fill of the rectangle with top-left vertex (x,y),
+ *  width w and height h with given color, and return immediately
+ * Parameters: same as tft_fillRect()
+ * Returns:     Nothing
+ * Note: the address window is set once and the DMA streams the color
+ *      in blocks of TFT_DMA_BLOCK pixels. Wait for the fill with
+ *      PT_TFT_DMA_WAIT(pt) or tft_dmaWait() before touching SPI1 directly
+ */
+
+  if (!tft_clipRect(&x, &y, &w, &h)) return;
+  if (tft_fill_hook) { tft_fill_hook(x, y, w, h, color); return; }
+
+  // waits for a previous fill, if there is one
+  tft_setAddrWindow(x, y, x+w-1, y+h-1);
+  tft_dmaFill(color, (unsigned int)w * h);
+}
+
+void tft_fillScreenDMA(unsigned short color) {
+/* Start a DMA fill of the entire screen with given color
+ * Parameters:
+ *      color: 16-bit color value
+ * Returns:  Nothing
+ */
+    tft_fillRectDMA(0, 0, _width, _height, color);
+}
+
+// === command lists ===
+// Entries go out with CS held low and SPI1 in 8-bit mode; D/C only flips
+// once the bus has drained. The CASET/PASET window is tracked so that a
+// TFT_LIST_FILL entry knows how many pixels to send.
+static unsigned short list_x0, list_x1, list_y0, list_y1;
+
+// send the command and arguments of the entry at addr, return the address
+// of its fill color (or delay byte, or the next entry)
+static const unsigned char *tft_listCommand(const unsigned char *addr) {
+  unsigned char cmd = *addr++;
+  unsigned char i, n = *addr++ & TFT_LIST_ARGS;
+
+  tft_spiDrain();
+  _dc_low();
+  WriteSPI1(cmd);
+  tft_spiDrain();
+  _dc_high();
+  for (i = 0; i < n; i++) {
+    while (TxBufFullSPI1());
+    WriteSPI1(addr[i]);
+  }
+  if (n == 4 && (cmd == ILI9340_CASET || cmd == ILI9340_PASET)) {
+    unsigned short a = (addr[0] << 8) | addr[1], b = (addr[2] << 8) | addr[3];
+    if (cmd == ILI9340_CASET) { list_x0 = a; list_x1 = b; }
+    else                      { list_y0 = a; list_y1 = b; }
+  }
+  return addr + n;
+}
+
+static unsigned long tft_listArea(void) {
+  return (unsigned long)(list_x1 - list_x0 + 1) * (list_y1 - list_y0 + 1);
+}
+
+// DELAY byte of an entry, if it has one
+static const unsigned char *tft_listDelay(const unsigned char *addr,
+        unsigned char flags) {
+  unsigned short ms;
+
+  if (flags & DELAY) {
+    ms = *addr++;
+    if (ms == 255) ms = 500;    // If 255, delay for 500 ms
+    tft_spiDrain();
+    delay_ms(ms);
+  }
+  return addr;
+}
+
+void tft_commandList(const unsigned char *addr) {
+/* Send a command list (see tft_master.h) in one CS-low burst
+ * Parameters:
+ *      addr:   the list, starting with its number of entries
+ * Returns:     Nothing
+ * Note: fills are streamed by the cpu; see tft_listStep() for a replay
+ *      with DMA fills. Draws straight to the panel, tft_fill_hook is not
+ *      consulted
+ */
+  unsigned char numCommands, flags;
+  unsigned long n;
+
+  tft_madctlRestore();
+  tft_sync();
+  win_valid = 0;
+  Mode8();
+  _cs_low();
+
+  numCommands = *addr++;
+  while (numCommands--) {
+    flags = addr[1];
+    addr = tft_listCommand(addr);
+    if (flags & TFT_LIST_FILL) {
+      unsigned short color = (addr[0] << 8) | addr[1];
+      addr += 2;
+      tft_spiDrain();
+      Mode16();
+      for (n = tft_listArea(); n > 0; n--) {
+        while (TxBufFullSPI1());
+        WriteSPI1(color);
+      }
+      tft_spiDrain();
+      Mode8();
+    }
+    addr = tft_listDelay(addr, flags);
+  }
+
+  tft_spiDrain();
+  Mode16();
+  _cs_high();
+}
+
+void tft_listStart(struct tft_list *l, const unsigned char *addr) {
+/* Get a command list ready for tft_listStep()
+ * Parameters:
+ *      l:      replay state
+ *      addr:   the list, starting with its number of entries
+ * Returns:     Nothing
+ */
+  l->left = *addr++;
+  l->next = addr;
+}
+
+char tft_listStep(struct tft_list *l) {
+/* Send command list entries up to and including the next fill, which is
+ *  left running on the DMA
+ * Parameters:
+ *      l:      replay state from tft_listStart()
+ * Returns:     nonzero while there is more to do: call again once
+ *      tft_dmaBusy() is 0 (PT_TFT_LIST does both). 0 once the list is done
+ */
+  const unsigned char *addr = l->next;
+  unsigned char flags;
+
+  if (tft_dmaBusy()) return 1;
+  if (!l->left) return 0;
+
+  tft_madctlRestore();
+  tft_sync();
+  win_valid = 0;
+  Mode8();
+  _cs_low();
+
+  while (l->left) {
+    l->left--;
+    flags = addr[1];
+    addr = tft_listCommand(addr);
+    if (flags & TFT_LIST_FILL) {
+      unsigned short color = (addr[0] << 8) | addr[1];
+      addr += 2;
+      // the fill runs on after we return: a DELAY on this entry is skipped
+      l->next = (flags & DELAY) ? addr + 1 : addr;
+      tft_spiDrain();
+      Mode16();
+      tft_dmaFill(color, tft_listArea());
+      return 1;
+    }
+    addr = tft_listDelay(addr, flags);
   }
 
+  l->next = addr;
+  tft_spiDrain();
+  Mode16();
   _cs_high();
+  return 0;
 }
 
 inline unsigned short tft_Color565(unsigned char r, unsigned char g, unsigned char b) {
@@ -508,31 +1020,58 @@ inline unsigned short tft_Color565(unsigned char r, unsigned char g, unsigned ch
 
 
 void tft_setRotation(unsigned char m) {
-  unsigned char rotation;
+/* Set the display rotation in 90 degree steps
+ * Parameters:
+ *      m:  0 = portrait (240x320), 1 = landscape, 2 = portrait upside
+ *          down, 3 = landscape the other way round
+ * Returns:     Nothing
+ * Note: sets rotation, _width and _height (tft_gfx_setRotation() is the
+ *      same call) and resets the clip stack
+ */
+  rotation = m & 3;
+  tft_madctl_rot = tft_rot_madctl[rotation];
   tft_writecommand(ILI9340_MADCTL);
-  rotation = m % 4; // can't be higher than 3
-  switch (rotation) {
-   case 0:
-     tft_writedata(ILI9340_MADCTL_MX | ILI9340_MADCTL_BGR);
-     _width  = ILI9340_TFTWIDTH;
-     _height = ILI9340_TFTHEIGHT;
-     break;
-   case 1:
-     tft_writedata(ILI9340_MADCTL_MV | ILI9340_MADCTL_BGR);
-     _width  = ILI9340_TFTHEIGHT;
-     _height = ILI9340_TFTWIDTH;
-     break;
-  case 2:
-    tft_writedata(ILI9340_MADCTL_MY | ILI9340_MADCTL_BGR);
-     _width  = ILI9340_TFTWIDTH;
-     _height = ILI9340_TFTHEIGHT;
-    break;
-   case 3:
-     tft_writedata(ILI9340_MADCTL_MV | ILI9340_MADCTL_MY | ILI9340_MADCTL_MX | ILI9340_MADCTL_BGR);
-     _width  = ILI9340_TFTHEIGHT;
-     _height = ILI9340_TFTWIDTH;
-     break;
+  tft_writedata(tft_madctl_rot);
+  tft_madctl = tft_madctl_rot;
+  if (rotation & 1) {
+    _width  = ILI9340_TFTHEIGHT;
+    _height = ILI9340_TFTWIDTH;
+  } else {
+    _width  = ILI9340_TFTWIDTH;
+    _height = ILI9340_TFTHEIGHT;
   }
+  tft_clipReset();
+}
+
+void tft_scrollDefine(unsigned short top, unsigned short bottom) {
+/* Split the panel into a fixed top area, a vertical scroll area and a
+ * fixed bottom area
+ * Parameters:
+ *      top:    rows of the top fixed area
+ *      bottom: rows of the bottom fixed area
+ * Returns:     Nothing
+ * Note: rows are panel (GRAM) rows, which are the screen rows for
+ *      tft_setRotation(0). tft_scrollDefine(0, 0) undoes the split
+ */
+  tft_sync();
+  tft_wincommand(ILI9340_VSCRDEF);
+  tft_windata16(top);
+  tft_windata16(ILI9340_TFTHEIGHT - top - bottom);
+  tft_windata16(bottom);
+}
+
+void tft_scrollTo(unsigned short line) {
+/* Set the GRAM row shown at the top of the vertical scroll area
+ * Parameters:
+ *      line:   GRAM row, from top to ILI9340_TFTHEIGHT - bottom - 1 as
+ *              given to tft_scrollDefine()
+ * Returns:     Nothing
+ * Note: only the panel's read-out changes, GRAM and the address window
+ *      are untouched
+ */
+  tft_sync();
+  tft_wincommand(ILI9340_VSCRSADD);
+  tft_windata16(line);
 }
 
 void delay_ms(unsigned long i){
@@ -540,14 +1079,14 @@ void delay_ms(unsigned long i){
  * Parameters:
  *      i:  equal to number of milliseconds for delay
  * Returns: Nothing
- * Note: Uses Core Timer. Core Timer is cleared at the initialiazion of
- *      this function. So, applications sensitive to the Core Timer are going
- *      to be affected
+ * Note: Uses Core Timer. It waits for the count to move on by the delay
+ *      and leaves it running, so the profiler and other code timing with
+ *      ReadCoreTimer() differences are not affected
  */
-    unsigned int j;
+    unsigned int j, start;
     j = dTime_ms * i;
-    WriteCoreTimer(0);
-    while (ReadCoreTimer() < j);
+    start = ReadCoreTimer();
+    while (ReadCoreTimer() - start < j);
 }
 
 void delay_us(unsigned long i){
@@ -555,14 +1094,14 @@ void delay_us(unsigned long i){
  * Parameters:
  *      i:  equal to number of microseconds for delay
  * Returns: Nothing
- * Note: Uses Core Timer. Core Timer is cleared at the initialiazion of
- *      this function. So, applications sensitive to the Core Timer are going
- *      to be affected
+ * Note: Uses Core Timer. It waits for the count to move on by the delay
+ *      and leaves it running, so the profiler and other code timing with
+ *      ReadCoreTimer() differences are not affected
  */
-    unsigned int j;
+    unsigned int j, start;
     j = dTime_us * i;
-    WriteCoreTimer(0);
-    while (ReadCoreTimer() < j);
+    start = ReadCoreTimer();
+    while (ReadCoreTimer() - start < j);
 }
 
 //void tft_invertDisplay(boolean i) {
@@ -70,7 +70,9 @@
 #define ILI9340_RAMRD   0x2E
 
 #define ILI9340_PTLAR   0x30
+#define ILI9340_VSCRDEF 0x33
 #define ILI9340_MADCTL  0x36
+#define ILI9340_VSCRSADD 0x37
 
 
 #define ILI9340_MADCTL_MY  0x80
@@ -124,6 +126,19 @@
 
 #define tabspace 4 // number of spaces for a tab
 
+// SPI1 word width for pixels and window arguments: 16, one pixel or
+// coordinate per word. Command bytes go out in 8-bit mode. D/C has to
+// settle between a command and its arguments, so the bus is drained around
+// every command anyway and the mode switch costs no wire time, where NOP
+// bytes padding a command out to a wider word would. Packing two pixels
+// per 32-bit word only halves the FIFO writes, for the same wire time.
+#ifndef TFT_SPI_WIDTH
+#define TFT_SPI_WIDTH 16
+#endif
+#if TFT_SPI_WIDTH != 16
+#error "TFT_SPI_WIDTH must be 16: the 8- and 32-bit framings were dropped"
+#endif
+
 #define dTime_ms PBCLK/2000
 #define dTime_us PBCLK/2000000
 
@@ -135,10 +150,13 @@ void tft_writecommand(unsigned char c);
 void tft_writecommand16(unsigned short c);
 void tft_writedata(unsigned char c);
 void tft_writedata16(unsigned short c);
-void tft_commandList(unsigned char *addr);
+void tft_commandList(const unsigned char *addr);
 void tft_begin(void);
 void tft_setAddrWindow(unsigned short x0, unsigned short y0, unsigned short x1, unsigned short y1);
+void tft_setAddrWindowCols(unsigned short x0, unsigned short y0, unsigned short x1, unsigned short y1);
 void tft_pushColor(unsigned short color);
+void tft_pushColors(const unsigned short *colors, unsigned short n);
+void tft_pushRun(unsigned short color, unsigned long n);
 void tft_drawPixel(short x, short y, unsigned short color);
 void tft_drawFastVLine(short x, short y, short h, unsigned short color);
 void tft_drawFastHLine(short x, short y, short w, unsigned short color);
@@ -146,11 +164,131 @@ void tft_fillScreen(unsigned short color);
 void tft_fillRect(short x, short y, short w, short h, unsigned short color);
 unsigned short tft_Color565(unsigned char r, unsigned char g, unsigned char b);
 void tft_setRotation(unsigned char m);
+void tft_scrollDefine(unsigned short top, unsigned short bottom);
+void tft_scrollTo(unsigned short line);
 unsigned char tft_spiread(void);
 unsigned char tft_readdata(void);
 unsigned char tft_readcommand8(unsigned char c);
 
 unsigned short _width, _height;
+// 0..3 as set by tft_setRotation(), the same variable as in tft_gfx.h
+unsigned short rotation;
+
+// address window cache counters (bytes of CASET/PASET/RAMWR + arguments)
+// see tft_setAddrWindow()
+unsigned long tft_win_sent, tft_win_elided;
+// MADCTL changes for column windows and back, see tft_setAddrWindowCols()
+unsigned long tft_madctl_switches;
+
+// === clipping and viewports ===
+// Drawing calls take coordinates relative to an origin and only touch
+// pixels inside a clip rectangle; both start out as the whole screen.
+// tft_clipPush() narrows the clip rectangle, tft_viewportPush() also moves
+// the origin to the rectangle's top left corner, so a widget can draw
+// itself at (0,0) wherever it sits; tft_clipPop() undoes the last push.
+//      tft_viewportPush(120, 40, 100, 60);   // a 100x60 panel
+//      tft_fillScreen(ILI9340_BLACK);         // fills just the panel
+//      tft_drawLine(-10, 30, 200, 30, ILI9340_GREEN);  // cut at its edges
+//      tft_clipPop();
+// Each primitive is clipped once, as a whole: a rectangle or line span
+// outside the clip sends nothing, one partly inside sends only what is
+// left of it, with no test per pixel. Pushes are relative to the current
+// origin and can only shrink the clip rectangle.
+// Applies to tft_drawPixel, tft_drawFastVLine/HLine, tft_fillRect(DMA),
+// everything in tft_gfx.c, tft_font.h and tft_bitmap.h. Raw address
+// windows (tft_setAddrWindow and the streams after it), sprites, scopes
+// and tiles stay in screen coordinates; the console sets the whole screen
+// around its own drawing and puts the caller's origin and clip back.
+// tft_setRotation() and tft_gfx_setRotation() reset the stack.
+#ifndef TFT_CLIP_DEPTH
+#define TFT_CLIP_DEPTH  8   // pushes kept; deeper ones do nothing
+#endif
+
+// tft_clipRect() results
+#define TFT_CLIP_OUT    0   // nothing of it is inside the clip rectangle
+#define TFT_CLIP_PART   1   // it was cut to fit
+#define TFT_CLIP_IN     2   // all of it is inside
+
+void tft_clipPush(short x, short y, short w, short h);
+void tft_viewportPush(short x, short y, short w, short h);
+void tft_clipPop(void);
+void tft_clipReset(void);
+char tft_clipRect(short *x, short *y, short *w, short *h);
+
+// origin and clip rectangle (tft_clip_x0 <= x < tft_clip_x1, same for y),
+// in screen coordinates
+short tft_org_x, tft_org_y;
+short tft_clip_x0, tft_clip_y0, tft_clip_x1, tft_clip_y1;
+
+// === render target hook ===
+// While set, tft_drawPixel, tft_drawFastVLine, tft_drawFastHLine, tft_fillRect
+// and tft_fillRectDMA (so everything in tft_gfx.c) hand their rectangle to
+// this function instead of the panel, already clipped and in screen
+// coordinates. Used by the tile renderer, tft_tile.c
+extern void (*tft_fill_hook)(short x, short y, short w, short h, unsigned short color);
+
+// === DMA fill path ===
+// A DMA channel streams the fill color into SPI1BUF while the cpu goes on
+// running other threads. Start a fill with tft_fillRectDMA() and finish it
+// with PT_TFT_DMA_WAIT(pt) inside a thread or tft_dmaWait() outside one.
+// tft_pushColorsDMA() streams a RAM buffer the same way (see tft_band.h).
+// Any other tft_ call made while a fill is running waits for it first.
+#define TFT_DMA_CHN     DMA_CHANNEL2
+#define TFT_DMA_INT     INT_DMA2
+#define TFT_DMA_VECTOR  INT_DMA_2_VECTOR
+#define TFT_DMA_BLOCK   256 // pixels per DMA block (size of the pattern buffer)
+#define TFT_DMA_STREAM_BLOCK 16384  // pixels per block of a buffer stream
+
+void tft_fillRectDMA(short x, short y, short w, short h, unsigned short color);
+void tft_fillScreenDMA(unsigned short color);
+void tft_pushColorsDMA(const unsigned short *colors, unsigned long n);
+char tft_dmaBusy(void);
+void tft_dmaWait(void);
+
+// yield the calling thread until the DMA fill has drained onto the bus
+#define PT_TFT_DMA_WAIT(pt) PT_WAIT_UNTIL(pt, !tft_dmaBusy())
+
+// === command lists ===
+// A packed table of panel commands, sent by tft_commandList() in one
+// CS-low burst. Used for the init sequence in tft_begin() and for display
+// lists, e.g. the static background of a screen. Layout:
+//   number of entries, then for each entry
+//     command byte
+//     argument count, or'ed with DELAY and/or TFT_LIST_FILL
+//     the arguments
+//     if TFT_LIST_FILL: color high byte, low byte. The whole CASET/PASET
+//         window last set in this list is filled with it (after a RAMWR)
+//     if DELAY: delay in ms, 255 = 500 ms
+#define DELAY         0x80
+#define TFT_LIST_FILL 0x40
+#define TFT_LIST_ARGS 0x3F
+
+// a filled rectangle as three entries: CASET, PASET and RAMWR + fill
+#define TFT_LIST_RECT(x, y, w, h, color) \
+    ILI9340_CASET, 4, (x) >> 8, (x) & 0xFF, \
+        ((x) + (w) - 1) >> 8, ((x) + (w) - 1) & 0xFF, \
+    ILI9340_PASET, 4, (y) >> 8, (y) & 0xFF, \
+        ((y) + (h) - 1) >> 8, ((y) + (h) - 1) & 0xFF, \
+    ILI9340_RAMWR, TFT_LIST_FILL, (color) >> 8, (color) & 0xFF
+
+// The same list replayed a step at a time, with every fill handed to the
+// DMA. tft_listStep() sends entries up to the next fill, starts it and
+// returns nonzero; called again once the fill is done it goes on, and it
+// returns 0 at the end of the list. DELAY entries still spin, and a DELAY
+// on a fill entry is skipped.
+struct tft_list {
+    const unsigned char *next;  // next entry
+    unsigned char left;         // entries still to send
+};
+void tft_listStart(struct tft_list *l, const unsigned char *addr);
+char tft_listStep(struct tft_list *l);
+
+// replay a display list from a thread, yielding while the DMA fills
+#define PT_TFT_LIST(pt, l, addr) \
+    do { \
+        tft_listStart(l, addr); \
+        PT_WAIT_UNTIL(pt, !tft_dmaBusy() && !tft_listStep(l)); \
+    } while (0)
 
 void delay_ms(unsigned long);
 void delay_us(unsigned long);
\ No newline at end of file
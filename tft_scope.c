@@ -0,0 +1,252 @@
+/*
+ * File:   tft_scope.c
+ * Oscilloscope / strip chart widget for the TFT, see tft_scope.h
+ *
+ * Samples go into a ring of w columns. In SWEEP and HWSCROLL mode ring
+ * column i is drawn at plot column i (HWSCROLL then moves the panel's
+ * scroll start so the oldest column shows on the left); in SCROLL mode
+ * plot column k shows ring column head+k. Vertical grid lines belong to
+ * ring columns, so in the strip charts they move with the trace.
+ */
+
+#include "plib.h"
+#include "tft_master.h"
+#include "tft_scope.h"
+
+#define EMPTY_TOP 0x7fff    // top of a column without trace
+
+// plot row of a sample value, clamped to the plot
+static short tft_scopeRow(struct tft_scope *s, short v) {
+    long r = (long)(s->hi - v) * (s->h - 1) / (s->hi - s->lo);
+
+    if (r < 0) return 0;
+    if (r >= s->h) return s->h - 1;
+    return r;
+}
+
+// pixels waiting to go out as one run
+static unsigned short scope_color;
+static unsigned long scope_run, scope_pixels;
+
+static void tft_scopePut(unsigned short c) {
+    scope_pixels++;
+    if ((c != scope_color) && scope_run) {
+        tft_pushRun(scope_color, scope_run);
+        scope_run = 0;
+    }
+    scope_color = c;
+    scope_run++;
+}
+
+// stream rows a..b of ring column i into the open window
+static void tft_scopeRows(struct tft_scope *s, short i, short a, short b) {
+    char gridcol = (i % s->gx) == 0;
+    unsigned short c;
+    short r, ch;
+
+    for (r = a; r <= b; r++) {
+        c = (gridcol || (r % s->gy) == 0) ? s->grid : s->bg;
+        for (ch = 0; ch < s->channels; ch++)
+            if ((s->top[ch][i] <= r) && (r <= s->bot[ch][i])) c = s->color[ch];
+        tft_scopePut(c);
+    }
+}
+
+// send the last run of a window; sent counts the window bytes before it
+static void tft_scopeFlush(struct tft_scope *s, unsigned long sent) {
+    tft_pushRun(scope_color, scope_run);
+    s->bytes += (tft_win_sent - sent) + 2ul * scope_pixels;
+    scope_run = scope_pixels = 0;
+}
+
+static void tft_scopeColumn(struct tft_scope *s, short k, short i,
+        short a, short b) {
+// send rows a..b of plot column k, showing ring column i, in one window
+    unsigned long sent = tft_win_sent;
+
+    if (a < 0) a = 0;
+    if (b >= s->h) b = s->h - 1;
+    if (a > b) return;
+    tft_setAddrWindow(s->x + k, s->y + a, s->x + k, s->y + b);
+    tft_scopeRows(s, i, a, b);
+    tft_scopeFlush(s, sent);
+}
+
+void tft_scopeBegin(struct tft_scope *s, short x, short y, short w, short h,
+        unsigned char channels, unsigned char mode, short lo, short hi) {
+/* Set up a scope and draw its empty plot
+ * Parameters:
+ *      s:          the scope
+ *      x, y, w, h: plot area, w no more than TFT_SCOPE_MAXW
+ *      channels:   traces, up to TFT_SCOPE_CHANNELS
+ *      mode:       TFT_SCOPE_SWEEP, TFT_SCOPE_SCROLL or TFT_SCOPE_HWSCROLL
+ *      lo, hi:     sample values at the bottom and top of the plot
+ * Returns:     Nothing
+ * Note: the colors start as black background, dark grey grid, yellow and
+ *      cyan traces; change them in s and call tft_scopeRedraw() for others
+ */
+    short ch, i;
+
+    if (w > TFT_SCOPE_MAXW) w = TFT_SCOPE_MAXW;
+    if (channels > TFT_SCOPE_CHANNELS) channels = TFT_SCOPE_CHANNELS;
+    s->x = x;
+    s->y = y;
+    s->w = w;
+    s->h = h;
+    s->lo = lo;
+    s->hi = (hi != lo) ? hi : lo + 1;
+    s->channels = channels;
+    s->mode = mode;
+    s->gx = (w >= 10) ? w / 10 : 1;
+    s->gy = (h >= 8) ? h / 8 : 1;
+    s->bg = ILI9340_BLACK;
+    s->grid = 0x2104;
+    for (ch = 0; ch < TFT_SCOPE_CHANNELS; ch++) {
+        s->color[ch] = (ch & 1) ? ILI9340_CYAN : ILI9340_YELLOW;
+        s->last[ch] = -1;
+        for (i = 0; i < TFT_SCOPE_MAXW; i++) {
+            s->top[ch][i] = EMPTY_TOP;
+            s->bot[ch][i] = -1;
+        }
+    }
+    s->head = 0;
+    s->samples = s->frames = s->bytes = 0;
+
+    if (mode == TFT_SCOPE_HWSCROLL)
+        tft_scrollDefine(x, ILI9340_TFTHEIGHT - x - w);
+    tft_scopeRedraw(s);
+}
+
+void tft_scopeRedraw(struct tft_scope *s) {
+/* Draw the whole plot again from the history
+ * Parameters:
+ *      s:  the scope
+ * Returns:     Nothing
+ * Note: the plot goes out column by column as one column order window,
+ *      see tft_setAddrWindowCols()
+ */
+    unsigned long sent = tft_win_sent, switches = tft_madctl_switches;
+    short k;
+
+    tft_setAddrWindowCols(s->x, s->y, s->x + s->w - 1, s->y + s->h - 1);
+    for (k = 0; k < s->w; k++)
+        tft_scopeRows(s, (s->mode == TFT_SCOPE_SCROLL) ?
+                (s->head + k) % s->w : k, 0, s->h - 1);
+    tft_scopeFlush(s, sent);
+    // MADCTL there (and later back): command and argument each way
+    if (tft_madctl_switches != switches) s->bytes += 4;
+    if (s->mode == TFT_SCOPE_HWSCROLL) tft_scrollTo(s->x + s->head);
+}
+
+// rows of one column to send: old and new trace of each channel
+struct tft_scope_rows {
+    short n, top[2 * TFT_SCOPE_CHANNELS], bot[2 * TFT_SCOPE_CHANNELS];
+};
+
+static void tft_scopeAddRows(struct tft_scope_rows *l, short t, short b) {
+    if (t <= b) {
+        l->top[l->n] = t;
+        l->bot[l->n++] = b;
+    }
+}
+
+static void tft_scopeSend(struct tft_scope *s, short k, short i,
+        struct tft_scope_rows *l) {
+// send the rows in l of plot column k, overlapping ones as one window.
+// The column stays the same, so after the first window only PASET changes
+    short j, m, t, b;
+
+    while (l->n) {
+        // the topmost run, grown by every run it touches
+        for (m = 0, j = 1; j < l->n; j++)
+            if (l->top[j] < l->top[m]) m = j;
+        t = l->top[m];
+        b = l->bot[m];
+        l->top[m] = l->top[--l->n];
+        l->bot[m] = l->bot[l->n];
+        for (j = 0; j < l->n; )
+            if (l->top[j] <= b + 1) {
+                if (l->bot[j] > b) b = l->bot[j];
+                l->top[j] = l->top[--l->n];
+                l->bot[j] = l->bot[l->n];
+                j = 0;
+            } else j++;
+        tft_scopeColumn(s, k, i, t, b);
+    }
+}
+
+void tft_scopeSample(struct tft_scope *s, const short *v) {
+/* Add one sample to every channel
+ * Parameters:
+ *      s:  the scope
+ *      v:  one value per channel
+ * Returns:     Nothing
+ * Note: in SWEEP and HWSCROLL mode only the column of the new sample is
+ *      sent: one window over the rows of its old and new trace, or one per
+ *      group of rows when the channels are apart
+ */
+    short i = s->head, ch, row, prev, k, n, o;
+    short ot[TFT_SCOPE_CHANNELS], ob[TFT_SCOPE_CHANNELS];
+    struct tft_scope_rows l;
+
+    l.n = 0;
+    for (ch = 0; ch < s->channels; ch++) {
+        // what this column shows now, to be erased
+        ot[ch] = s->top[ch][i];
+        ob[ch] = s->bot[ch][i];
+        tft_scopeAddRows(&l, ot[ch], ob[ch]);
+        // the trace runs from the previous sample to this one
+        row = tft_scopeRow(s, v[ch]);
+        prev = (s->last[ch] < 0) ? row : s->last[ch];
+        s->top[ch][i] = (row < prev) ? row : prev;
+        s->bot[ch][i] = (row < prev) ? prev : row;
+        s->last[ch] = row;
+        tft_scopeAddRows(&l, s->top[ch][i], s->bot[ch][i]);
+    }
+    s->head = (i + 1) % s->w;
+    s->samples++;
+    if (!s->head) s->frames++;
+
+    if (s->mode != TFT_SCOPE_SCROLL) {
+        tft_scopeSend(s, i, i, &l);
+        if (s->mode == TFT_SCOPE_HWSCROLL) {
+            tft_scrollTo(s->x + s->head);
+            s->bytes += 3;
+        }
+        return;
+    }
+
+    // strip chart in software: plot column k showed ring column o and now
+    // shows n; redraw it where the two differ
+    for (k = 0; k < s->w; k++) {
+        n = (s->head + k) % s->w;
+        o = (i + k) % s->w;
+        l.n = 0;
+        if (((n % s->gx) == 0) != ((o % s->gx) == 0)) {
+            tft_scopeAddRows(&l, 0, s->h - 1);
+        } else {
+            for (ch = 0; ch < s->channels; ch++) {
+                short t0 = (k == 0) ? ot[ch] : s->top[ch][o];
+                short b0 = (k == 0) ? ob[ch] : s->bot[ch][o];
+                if ((t0 == s->top[ch][n]) && (b0 == s->bot[ch][n])) continue;
+                tft_scopeAddRows(&l, t0, b0);
+                tft_scopeAddRows(&l, s->top[ch][n], s->bot[ch][n]);
+            }
+        }
+        tft_scopeSend(s, k, n, &l);
+    }
+}
+
+void tft_scopeEnd(struct tft_scope *s) {
+/* Stop using a scope
+ * Parameters:
+ *      s:  the scope
+ * Returns:     Nothing
+ * Note: after HWSCROLL the panel goes back to an unscrolled screen; the
+ *      plot columns then show in ring order, redraw or clear them
+ */
+    if (s->mode == TFT_SCOPE_HWSCROLL) {
+        tft_scrollDefine(0, 0);
+        tft_scrollTo(0);
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * File:   tft_scope.h
+ * Oscilloscope / strip chart widget for the TFT
+ *
+ * Each sample takes one screen column. For every channel the widget keeps
+ * the rows the trace covers in each column (from the previous sample to
+ * this one, so the trace is continuous), and a new sample only redraws
+ * the column it lands in: old and new trace go out together as one
+ * vertical address window, background and grid included. A column costs a
+ * few dozen bytes of SPI traffic instead of a repaint of the plot.
+ *
+ * Modes:
+ *  TFT_SCOPE_SWEEP     the trace is written left to right over the old
+ *                      one, like an analog scope
+ *  TFT_SCOPE_SCROLL    strip chart: new samples enter on the right and the
+ *                      trace moves left. Done in software, every column
+ *                      whose contents change is redrawn, so this is for
+ *                      slow signals
+ *  TFT_SCOPE_HWSCROLL  the same strip chart on the panel's vertical scroll,
+ *                      as cheap as SWEEP. Needs tft_setRotation(1), where
+ *                      GRAM rows are screen columns; the plot then owns
+ *                      the screen columns x .. x+w-1 from top to bottom,
+ *                      anything else drawn there scrolls along
+ *
+ * Feed samples from a thread, e.g. from a ring buffer an ADC interrupt
+ * fills, see TFT_ADC_scope.c.
+ */
+
+#ifndef TFT_SCOPE_H
+#define TFT_SCOPE_H
+
+#ifndef TFT_SCOPE_CHANNELS
+#define TFT_SCOPE_CHANNELS  2
+#endif
+// widest plot, in columns
+#ifndef TFT_SCOPE_MAXW
+#define TFT_SCOPE_MAXW      320
+#endif
+
+#define TFT_SCOPE_SWEEP     0
+#define TFT_SCOPE_SCROLL    1
+#define TFT_SCOPE_HWSCROLL  2
+
+struct tft_scope {
+    // set by tft_scopeBegin(); colors may be changed before it draws
+    short x, y, w, h;                   // plot area
+    short lo, hi;                       // sample values at bottom and top
+    unsigned char channels, mode;
+    short gx, gy;                       // grid spacing, columns and rows
+    unsigned short bg, grid;
+    unsigned short color[TFT_SCOPE_CHANNELS];
+    // trace history, by ring column; top > bot for an empty column
+    short top[TFT_SCOPE_CHANNELS][TFT_SCOPE_MAXW];
+    short bot[TFT_SCOPE_CHANNELS][TFT_SCOPE_MAXW];
+    short last[TFT_SCOPE_CHANNELS];     // row of the previous sample
+    short head;                         // ring column of the next sample
+    // statistics: samples shown, full screens of them, SPI bytes sent
+    unsigned long samples, frames, bytes;
+};
+
+void tft_scopeBegin(struct tft_scope *s, short x, short y, short w, short h,
+        unsigned char channels, unsigned char mode, short lo, short hi);
+void tft_scopeSample(struct tft_scope *s, const short *v);
+void tft_scopeRedraw(struct tft_scope *s);
+void tft_scopeEnd(struct tft_scope *s);
+
+#endif /* TFT_SCOPE_H */
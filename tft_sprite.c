@@ -0,0 +1,253 @@
+/*
+ * File:   tft_sprite.c
+ * Sprites with save-under background restore, see tft_sprite.h
+ *
+ * The save-under buffer of a sprite only ever holds background, never
+ * other sprites: a composed rectangle is background first, then every
+ * sprite that reaches into it, bottom to top. That way sprites may
+ * overlap and move in any order within one update.
+ */
+
+#include <string.h>
+#include "plib.h"
+#include "tft_master.h"
+#include "tft_sprite.h"
+
+static struct tft_sprite *spr_list[TFT_SPRITE_MAX];    // bottom to top
+static unsigned char spr_count;
+static unsigned short spr_bg;
+static tft_sprite_bg_fn spr_bgfn;
+static unsigned short spr_buf[TFT_SPRITE_BUF];
+
+// background of part of a row, from the background function or color
+static void tft_spriteBg(short x, short y, short w, unsigned short *out) {
+    tft_sprite_bg_pixels += w;
+    if (spr_bgfn) spr_bgfn(x, y, w, out);
+    else while (w-- > 0) *out++ = spr_bg;
+}
+
+// draw sprite s into the composed rectangle at (x0,y0), w wide, h high
+static void tft_spriteOver(struct tft_sprite *s, short x0, short y0,
+        short w, short h) {
+    short i0 = x0 - s->x, j0 = y0 - s->y, i1 = i0 + w - 1, j1 = j0 + h - 1;
+    short i, j, stride = (s->w + 7) / 8;
+    unsigned short c, *p;
+
+    // clip the rectangle to the sprite, in sprite coordinates
+    if (i0 < 0) i0 = 0;
+    if (j0 < 0) j0 = 0;
+    if (i1 >= s->w) i1 = s->w - 1;
+    if (j1 >= s->h) j1 = s->h - 1;
+    for (j = j0; j <= j1; j++) {
+        p = &spr_buf[(s->y + j - y0) * w + s->x + i0 - x0];
+        for (i = i0; i <= i1; i++, p++) {
+            if (s->pix) {
+                c = s->pix[j * s->w + i];
+                if (s->keyed && c == s->key) continue;
+            } else {
+                unsigned char on = (s->bits[j * stride + i / 8] & (0x80 >> (i & 7))) != 0;
+                if (s->keyed && !on) continue;
+                c = s->color[on];
+            }
+            *p = c;
+        }
+    }
+}
+
+static void tft_spriteCompose(struct tft_sprite *s, short x0, short y0,
+        short x1, short y1, char save) {
+// compose the rectangle (x0,y0)-(x1,y1) and send it as one window. The
+// background under the old place of s comes from its save-under buffer;
+// with save set the buffer then takes the background of its new place
+    short x, y, w, h, a, b, i;
+    unsigned short *p;
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= _width)  x1 = _width - 1;
+    if (y1 >= _height) y1 = _height - 1;
+    if ((x0 > x1) || (y0 > y1)) return;
+    w = x1 - x0 + 1;
+    h = y1 - y0 + 1;
+
+    // background, all of it read before any of the buffer is overwritten
+    for (y = y0; y <= y1; y++) {
+        p = &spr_buf[(y - y0) * w];
+        a = x1 + 1;
+        b = x1;
+        if (s->shown && (y >= s->sy) && (y < s->sy + s->h)) {
+            a = (s->sx > x0) ? s->sx : x0;
+            b = (s->sx + s->w - 1 < x1) ? s->sx + s->w - 1 : x1;
+        }
+        if (a > b) {
+            tft_spriteBg(x0, y, w, p);
+            continue;
+        }
+        if (a > x0) tft_spriteBg(x0, y, a - x0, p);
+        for (x = a, i = (y - s->sy) * s->w + a - s->sx; x <= b; x++)
+            p[x - x0] = s->under[i++];
+        if (b < x1) tft_spriteBg(b + 1, y, x1 - b, p + b + 1 - x0);
+    }
+    if (save) {
+        for (y = y0; y <= y1; y++) {
+            if ((y < s->y) || (y >= s->y + s->h)) continue;
+            a = (s->x > x0) ? s->x : x0;
+            b = (s->x + s->w - 1 < x1) ? s->x + s->w - 1 : x1;
+            for (x = a, i = (y - s->y) * s->w + a - s->x; x <= b; x++)
+                s->under[i++] = spr_buf[(y - y0) * w + x - x0];
+        }
+    }
+    for (i = 0; i < spr_count; i++) {
+        struct tft_sprite *t = spr_list[i];
+        if ((t->x <= x1) && (t->x + t->w > x0) &&
+            (t->y <= y1) && (t->y + t->h > y0))
+            tft_spriteOver(t, x0, y0, w, h);
+    }
+
+    tft_setAddrWindow(x0, y0, x1, y1);
+    tft_pushColors(spr_buf, w * h);
+    tft_sprite_pixels += (unsigned long)w * h;
+}
+
+void tft_spriteInit565(struct tft_sprite *s, unsigned char w, unsigned char h,
+        const unsigned short *pix, unsigned short *under) {
+/* Set up a sprite with an RGB565 image
+ * Parameters:
+ *      s:      the sprite
+ *      w, h:   size in pixels, w*h no more than TFT_SPRITE_BUF
+ *      pix:    w*h colors, row by row
+ *      under:  save-under buffer of w*h pixels
+ * Returns:     Nothing
+ * Note: the image is opaque; set s->key and s->keyed = 1 to make the
+ *      pixels of one color see-through
+ */
+    memset(s, 0, sizeof(*s));
+    s->w = w;
+    s->h = h;
+    s->pix = pix;
+    s->under = under;
+}
+
+void tft_spriteInit1(struct tft_sprite *s, unsigned char w, unsigned char h,
+        const unsigned char *bits, unsigned short c0, unsigned short c1,
+        unsigned short *under) {
+/* Set up a sprite with a 1bpp image and a two color palette
+ * Parameters:
+ *      s:      the sprite
+ *      w, h:   size in pixels, w*h no more than TFT_SPRITE_BUF
+ *      bits:   (w+7)/8 bytes a row, most significant bit on the left
+ *      c0, c1: colors of 0 and 1 bits
+ *      under:  save-under buffer of w*h pixels
+ * Returns:     Nothing
+ * Note: 0 bits are see-through; set s->keyed = 0 to draw them in c0
+ */
+    memset(s, 0, sizeof(*s));
+    s->w = w;
+    s->h = h;
+    s->bits = bits;
+    s->color[0] = c0;
+    s->color[1] = c1;
+    s->keyed = 1;
+    s->under = under;
+}
+
+void tft_spriteBegin(unsigned short bg, tft_sprite_bg_fn fn) {
+/* Start over with no sprites
+ * Parameters:
+ *      bg: background color, used when fn is NULL
+ *      fn: background row function, or NULL for a plain bg background
+ * Returns:     Nothing
+ * Note: draws nothing; the background should already be on the screen
+ */
+    spr_count = 0;
+    spr_bg = bg;
+    spr_bgfn = fn;
+}
+
+void tft_spriteAdd(struct tft_sprite *s, short x, short y) {
+/* Put a sprite on top of all the others
+ * Parameters:
+ *      s:      the sprite, set up with tft_spriteInit565/1()
+ *      x, y:   top left corner
+ * Returns:     Nothing
+ * Note: it shows up with the next tft_spriteUpdate()
+ */
+    if (spr_count >= TFT_SPRITE_MAX) return;
+    spr_list[spr_count++] = s;
+    s->x = x;
+    s->y = y;
+    s->shown = 0;
+    s->moved = 1;
+}
+
+void tft_spriteRemove(struct tft_sprite *s) {
+/* Take a sprite off the screen, giving back what was under it
+ * Parameters:
+ *      s:  the sprite
+ * Returns:     Nothing
+ */
+    unsigned char i, j;
+
+    for (i = j = 0; i < spr_count; i++)
+        if (spr_list[i] != s) spr_list[j++] = spr_list[i];
+    if (j == spr_count) return;
+    spr_count = j;
+    if (s->shown)
+        tft_spriteCompose(s, s->sx, s->sy, s->sx + s->w - 1,
+                s->sy + s->h - 1, 0);
+    s->shown = 0;
+}
+
+void tft_spriteMove(struct tft_sprite *s, short x, short y) {
+/* Move a sprite
+ * Parameters:
+ *      s:      the sprite
+ *      x, y:   new top left corner
+ * Returns:     Nothing
+ * Note: takes effect with the next tft_spriteUpdate(). Moving a sprite
+ *      to where it is redraws it, e.g. after changing its image
+ */
+    s->x = x;
+    s->y = y;
+    s->moved = 1;
+}
+
+void tft_spriteUpdate(void) {
+/* Bring the screen up to date with the sprites added and moved since the
+ *  last update
+ * Returns:     Nothing
+ * Note: a move sends the union of the old and the new box in one window,
+ *      or the two boxes in two windows when the union would not fit in
+ *      TFT_SPRITE_BUF pixels (or would be the bigger transfer)
+ */
+    unsigned char i;
+    short x0, y0, x1, y1;
+
+    for (i = 0; i < spr_count; i++) {
+        struct tft_sprite *s = spr_list[i];
+        if (!s->moved) continue;
+        if (s->shown) {
+            x0 = (s->x < s->sx) ? s->x : s->sx;
+            y0 = (s->y < s->sy) ? s->y : s->sy;
+            x1 = ((s->x > s->sx) ? s->x : s->sx) + s->w - 1;
+            y1 = ((s->y > s->sy) ? s->y : s->sy) + s->h - 1;
+            if ((long)(x1 - x0 + 1) * (y1 - y0 + 1) <= TFT_SPRITE_BUF &&
+                (x1 - x0 + 1) * (y1 - y0 + 1) <= 2 * s->w * s->h) {
+                tft_spriteCompose(s, x0, y0, x1, y1, 1);
+            } else {
+                // old place first, without touching the save-under buffer
+                tft_spriteCompose(s, s->sx, s->sy, s->sx + s->w - 1,
+                        s->sy + s->h - 1, 0);
+                tft_spriteCompose(s, s->x, s->y, s->x + s->w - 1,
+                        s->y + s->h - 1, 1);
+            }
+        } else {
+            tft_spriteCompose(s, s->x, s->y, s->x + s->w - 1,
+                    s->y + s->h - 1, 1);
+        }
+        s->sx = s->x;
+        s->sy = s->y;
+        s->shown = 1;
+        s->moved = 0;
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * File:   tft_sprite.h
+ * Sprites with save-under background restore for the TFT
+ *
+ * Erasing a moving object by drawing it again in black wipes out whatever
+ * was under it and costs a second draw. A sprite instead keeps the
+ * background under it in its own save-under buffer. When it moves, the
+ * union of its old and new boxes is composed in RAM (background, then
+ * every sprite over it, bottom to top) and sent through one address
+ * window: the old place gets its background back and the new one the
+ * sprite, with no flicker in between.
+ *
+ * The panel cannot be read back (SDI is not wired, see tft_init_hw()), so
+ * the background has to come from the program: a plain color, or a
+ * function that renders a piece of one row of it. The save-under buffer
+ * means that function is only asked for the part a sprite newly covers.
+ *
+ * In a thread:
+ *      tft_spriteBegin(ILI9340_BLACK, draw_grid_row);
+ *      tft_spriteAdd(&ball, x, y);
+ *      while (1) {
+ *          tft_spriteMove(&ball, x, y);     // as many sprites as needed
+ *          tft_spriteUpdate();
+ *          PT_YIELD_TIME_msec(33);
+ *      }
+ * Sprites are sent straight to the panel, not inside tft_tileBegin() /
+ * tft_tileEnd().
+ */
+
+#ifndef TFT_SPRITE_H
+#define TFT_SPRITE_H
+
+// sprites in the stack at once
+#ifndef TFT_SPRITE_MAX
+#define TFT_SPRITE_MAX  16
+#endif
+// compose buffer in pixels: the most a move sends in one window. A move
+// whose union box is bigger goes out as two windows, so a sprite itself
+// must not be bigger than this
+#ifndef TFT_SPRITE_BUF
+#define TFT_SPRITE_BUF  1024
+#endif
+
+struct tft_sprite {
+    short x, y;                     // where the next update puts it
+    unsigned char w, h;             // size in pixels
+    const unsigned short *pix;      // RGB565 image, w*h row by row, or
+    const unsigned char *bits;      // 1bpp image, (w+7)/8 bytes a row, msb left
+    unsigned short color[2];        // 1bpp palette: 0 bits, 1 bits
+    unsigned short key;             // RGB565 color that is see-through
+    char keyed;                     // see-through: key pixels, or 0 bits
+    unsigned short *under;          // save-under buffer, w*h pixels
+    // engine state
+    short sx, sy;                   // where it is on the screen
+    char shown, moved;
+};
+
+// set up an RGB565 or a 1bpp sprite; under must hold w*h pixels
+void tft_spriteInit565(struct tft_sprite *s, unsigned char w, unsigned char h,
+        const unsigned short *pix, unsigned short *under);
+void tft_spriteInit1(struct tft_sprite *s, unsigned char w, unsigned char h,
+        const unsigned char *bits, unsigned short c0, unsigned short c1,
+        unsigned short *under);
+
+// background row function: fill out[0..w-1] with the background at
+// (x,y) .. (x+w-1,y)
+typedef void (*tft_sprite_bg_fn)(short x, short y, short w, unsigned short *out);
+
+void tft_spriteBegin(unsigned short bg, tft_sprite_bg_fn fn);
+void tft_spriteAdd(struct tft_sprite *s, short x, short y);
+void tft_spriteRemove(struct tft_sprite *s);
+void tft_spriteMove(struct tft_sprite *s, short x, short y);
+void tft_spriteUpdate(void);
+
+// pixels sent by sprite updates, and background pixels asked of the
+// background function
+unsigned long tft_sprite_pixels, tft_sprite_bg_pixels;
+
+#endif /* TFT_SPRITE_H */
@@ -0,0 +1,181 @@
+/*
+ * File:   tft_tile.c
+ * Off-screen tile renderer for the TFT, see tft_tile.h
+ *
+ * The screen is cut into a grid of TFT_TILE_WIDTH x TFT_TILE_HEIGHT cells.
+ * A cell gets a RAM tile from the pool the first time something is drawn
+ * into it during a frame. If the pool runs dry, the least recently used
+ * tile is flushed early and reused.
+ *
+ * A cell flushed early may be drawn into again later in the frame. Its
+ * new tile cannot be sent as a whole, as the background would wipe what
+ * went out with the first one, so such a tile keeps a mask of the pixels
+ * drawn since and sends only those, a run at a time.
+ */
+
+#include <string.h>
+#include "plib.h"
+#include "tft_master.h"
+#include "tft_tile.h"
+
+// mask words per tile row, and grid cells for either orientation
+#define TILE_MASK_WORDS ((TFT_TILE_WIDTH + 31) / 32)
+#define TILE_COLS ((ILI9340_TFTHEIGHT + TFT_TILE_WIDTH - 1) / TFT_TILE_WIDTH)
+#define TILE_ROWS ((ILI9340_TFTHEIGHT + TFT_TILE_HEIGHT - 1) / TFT_TILE_HEIGHT)
+
+struct tft_tile {
+    short cx, cy;               // grid cell, cx < 0 when free
+    short x0, y0, x1, y1;       // dirty rectangle, tile-relative
+    unsigned long used;         // for least-recently-used eviction
+    char revisit;               // cell already flushed this frame
+    unsigned long drawn[TFT_TILE_HEIGHT][TILE_MASK_WORDS]; // if revisit
+    unsigned short pix[TFT_TILE_WIDTH * TFT_TILE_HEIGHT];
+};
+
+static struct tft_tile tiles[TFT_TILE_POOL];
+static unsigned short tile_bg;
+static unsigned long tile_clock;
+// cells flushed early during this frame
+static unsigned long tile_flushed[(TILE_COLS * TILE_ROWS + 31) / 32];
+
+static char tft_tileDrawn(struct tft_tile *t, short x, short y) {
+    return (t->drawn[y][x >> 5] >> (x & 31)) & 1;
+}
+
+static void tft_tileSend(struct tft_tile *t, short x0, short y0, short x1,
+        short y1) {
+// send a tile-relative rectangle of a tile through one address window
+    short x = t->cx * TFT_TILE_WIDTH, y = t->cy * TFT_TILE_HEIGHT;
+    short row, w = x1 - x0 + 1;
+    unsigned long sent = tft_win_sent;
+
+    tft_setAddrWindow(x + x0, y + y0, x + x1, y + y1);
+    for (row = y0; row <= y1; row++)
+        tft_pushColors(&t->pix[row * TFT_TILE_WIDTH + x0], w);
+    tft_tile_bytes += (tft_win_sent - sent) + 2ul * w * (y1 - y0 + 1);
+}
+
+static void tft_tileFlush(struct tft_tile *t) {
+// send the dirty rectangle of a tile, or of a revisited one the pixels
+// drawn into it
+    void (*hook)(short, short, short, short, unsigned short) = tft_fill_hook;
+    short row, i, run;
+
+    tft_fill_hook = NULL;
+    if (!t->revisit)
+        tft_tileSend(t, t->x0, t->y0, t->x1, t->y1);
+    else {
+        for (row = t->y0; row <= t->y1; row++) {
+            for (i = t->x0; i <= t->x1; i = run + 1) {
+                if (!tft_tileDrawn(t, i, row)) { run = i; continue; }
+                for (run = i; run < t->x1 && tft_tileDrawn(t, run + 1, row); run++) ;
+                tft_tileSend(t, i, row, run, row);
+            }
+        }
+    }
+    tft_fill_hook = hook;
+
+    i = t->cy * TILE_COLS + t->cx;
+    tile_flushed[i >> 5] |= 1ul << (i & 31);
+    t->cx = -1;
+}
+
+static struct tft_tile *tft_tileGet(short cx, short cy) {
+// find the tile mapped to grid cell (cx,cy), mapping a fresh one if needed
+    struct tft_tile *t, *free = NULL, *lru = &tiles[0];
+    short i;
+
+    for (i = 0, t = tiles; i < TFT_TILE_POOL; i++, t++) {
+        if (t->cx == cx && t->cy == cy) {
+            t->used = ++tile_clock;
+            return t;
+        }
+        if (t->cx < 0) free = t;
+        else if (t->used < lru->used) lru = t;
+    }
+    if (!free) {
+        tft_tileFlush(lru);
+        tft_tile_evictions++;
+        free = lru;
+    }
+    for (i = 0; i < TFT_TILE_WIDTH * TFT_TILE_HEIGHT; i++)
+        free->pix[i] = tile_bg;
+    free->cx = cx;
+    free->cy = cy;
+    free->x0 = TFT_TILE_WIDTH;   // empty dirty rectangle
+    free->y0 = TFT_TILE_HEIGHT;
+    free->x1 = free->y1 = -1;
+    free->used = ++tile_clock;
+    i = cy * TILE_COLS + cx;
+    free->revisit = (tile_flushed[i >> 5] >> (i & 31)) & 1;
+    if (free->revisit) memset(free->drawn, 0, sizeof(free->drawn));
+    return free;
+}
+
+void tft_tileFill(short x, short y, short w, short h, unsigned short color) {
+/* Fill a rectangle in the off-screen tiles
+ * Parameters: same as tft_fillRect()
+ * Returns:     Nothing
+ * Note: this is the tft_fill_hook while a tiled frame is open
+ */
+    short x1, y1, cx, cy;
+
+    // clip to the screen
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > _width)  w = _width - x;
+    if (y + h > _height) h = _height - y;
+    if ((w <= 0) || (h <= 0)) return;
+    tft_tile_direct_bytes += 11 + 2ul * w * h;
+
+    x1 = x + w - 1;
+    y1 = y + h - 1;
+    for (cy = y / TFT_TILE_HEIGHT; cy <= y1 / TFT_TILE_HEIGHT; cy++) {
+        for (cx = x / TFT_TILE_WIDTH; cx <= x1 / TFT_TILE_WIDTH; cx++) {
+            struct tft_tile *t = tft_tileGet(cx, cy);
+            // the part of the rectangle inside this tile
+            short tx0 = x - cx * TFT_TILE_WIDTH, ty0 = y - cy * TFT_TILE_HEIGHT;
+            short tx1 = x1 - cx * TFT_TILE_WIDTH, ty1 = y1 - cy * TFT_TILE_HEIGHT;
+            short i, j;
+            if (tx0 < 0) tx0 = 0;
+            if (ty0 < 0) ty0 = 0;
+            if (tx1 >= TFT_TILE_WIDTH)  tx1 = TFT_TILE_WIDTH - 1;
+            if (ty1 >= TFT_TILE_HEIGHT) ty1 = TFT_TILE_HEIGHT - 1;
+            for (j = ty0; j <= ty1; j++) {
+                unsigned short *p = &t->pix[j * TFT_TILE_WIDTH + tx0];
+                for (i = tx0; i <= tx1; i++) *p++ = color;
+                if (t->revisit)
+                    for (i = tx0; i <= tx1; i++)
+                        t->drawn[j][i >> 5] |= 1ul << (i & 31);
+            }
+            if (tx0 < t->x0) t->x0 = tx0;
+            if (ty0 < t->y0) t->y0 = ty0;
+            if (tx1 > t->x1) t->x1 = tx1;
+            if (ty1 > t->y1) t->y1 = ty1;
+        }
+    }
+}
+
+void tft_tileBegin(unsigned short bg) {
+/* Start an off-screen frame: from now on all drawing goes to the tiles
+ * Parameters:
+ *      bg: color the tiles start out with, i.e. the background of the
+ *          area being redrawn
+ * Returns:     Nothing
+ */
+    short i;
+    for (i = 0; i < TFT_TILE_POOL; i++) tiles[i].cx = -1;
+    memset(tile_flushed, 0, sizeof(tile_flushed));
+    tile_bg = bg;
+    tft_fill_hook = tft_tileFill;
+}
+
+void tft_tileEnd(void) {
+/* Finish the frame: send every dirty tile and go back to drawing directly
+ * Returns:     Nothing
+ */
+    short i;
+    for (i = 0; i < TFT_TILE_POOL; i++)
+        if (tiles[i].cx >= 0) tft_tileFlush(&tiles[i]);
+    tft_fill_hook = NULL;
+}
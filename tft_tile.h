@@ -0,0 +1,44 @@
+/*
+ * File:   tft_tile.h
+ * Off-screen tile renderer for the TFT
+ *
+ * A full 240x320 RGB565 frame is 150 KB, far more than the 32 KB of RAM on
+ * the PIC32MX250. Instead, a small pool of tiles is mapped onto the screen
+ * on demand. Between tft_tileBegin() and tft_tileEnd() every tft_gfx.c
+ * primitive draws into these tiles, and tft_tileEnd() sends only the dirty
+ * rectangle of each tile, each through one address window. An erase and
+ * redraw of the same area therefore reaches the panel once, without flicker.
+ *
+ * Tiles start out filled with the background color given to tft_tileBegin().
+ * Anything inside a dirty rectangle that was not drawn during the frame is
+ * sent as background, so the area being redrawn must lie on that color.
+ * A cell whose tile was flushed early (tft_tile_evictions) and is drawn
+ * into again sends only the pixels drawn after that, so nothing sent
+ * with the first tile is painted over.
+ */
+
+#ifndef TFT_TILE_H
+#define TFT_TILE_H
+
+// tile size in pixels and number of tiles in the pool (1 KB each)
+#ifndef TFT_TILE_WIDTH
+#define TFT_TILE_WIDTH  32
+#endif
+#ifndef TFT_TILE_HEIGHT
+#define TFT_TILE_HEIGHT 16
+#endif
+#ifndef TFT_TILE_POOL
+#define TFT_TILE_POOL   12
+#endif
+
+void tft_tileBegin(unsigned short bg);
+void tft_tileEnd(void);
+void tft_tileFill(short x, short y, short w, short h, unsigned short color);
+
+// bytes sent to the panel by tile flushes, and what the same primitives
+// would have sent drawn directly (window setup + pixels, no caching)
+unsigned long tft_tile_bytes, tft_tile_direct_bytes;
+// tiles flushed early because the pool ran out during a frame
+unsigned long tft_tile_evictions;
+
+#endif /* TFT_TILE_H */